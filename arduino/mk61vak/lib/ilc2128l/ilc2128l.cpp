@@ -5,98 +5,46 @@
 	svofski 2024
 
 */
+#include <stdint.h>
+#include <string.h>
 #include "ilc2128l.h"
 #include "sh1122.h"
+#include "eggog_atlas.h"
 
-constexpr int eggog_stride = 357;
-constexpr int glyph_w = 21;
-constexpr int glyph_h = 28;
-constexpr int glyph9_h = 14;
-constexpr int glyph_dot_y = 21;
-constexpr int glyph_dot_h = 6;
+constexpr int glyph_w = EGGOG_CELL_W;
+constexpr int glyph_h = EGGOG_CELL_H;
+constexpr int glyph_dst_y = OLED_HEIGHT / 2  - glyph_h / 2;
 
-// VFD glyph tilemap
-extern uint8_t eggog_traced_pgm[];
+// the atlas is dithered for cells at even y, and for pos 0 at even x and pos 9 at odd
+static_assert(glyph_dst_y % 2 == 0, "eggog_atlas.h dither needs an even y");
+static_assert(9 * glyph_w % 2 == 1, "eggog_atlas.h half-digit needs an odd x");
 
-static int dither_frame = 0;
-
-int get_glyph_src_x(int c)
+// glyph cell from the atlas, see tools/glyphgen.py
+const uint8_t *get_glyph(int pos, int digit, bool dot)
 {
-	if (c >= '0' && c <= '9') {
-		return glyph_w * (c - '0'); 
+	if (pos == 0) {
+		// pos 0 has only "-" 
+		return EGGOG_SIGN(digit == '-' || digit == 'A' || digit == 10);
 	}
-	else if (c >= 'A' && c <= 'F') {
-		return glyph_w * (c - 'A' + 10);
+	if (digit < 0 || digit > 16) {
+		digit = 0;
 	}
-	else if (c == '-') {
-		return glyph_w * 10; // fix with real '-' later
+	if (pos == 9) {
+		// special half-digit with fat minus for exponent sign and advanced eggoggery
+		return EGGOG_HALF(digit, dot);
 	}
-
-	return glyph_w * 15;
+	return EGGOG_DIGIT(digit, dot, pos * glyph_w % 2);
 }
 
-int get_glyph_src_x_int(int c)
-{
-	if (c >= 0 && c <= 16) {
-		return glyph_w * c;
-	}
-	return 0;
-}
-
-
-#define DITHER 1
-
-void copy_glyph(int src_x, int src_y, int dst_x, int dst_y, int src_h = glyph_h)
+void draw_digit(int pos, int digit, bool dot, int dst_y)
 {
-	for (int y = 0; y < src_h; ++y) {
-		for (int x = 0; x < glyph_h; ++x) {
-			int c = eggog_traced_pgm[(y + src_y) * eggog_stride + x + src_x] / 16;
-			int ic = IndexedColor[c];
-			#if DITHER
-			if (c == 1) {
-				if (1 & ((dither_frame + dst_x + x) ^ (dst_y + y))) {
-					ic = 0;
-				}
-			}
-			#endif
-			Frame_DrawPixel(dst_x + x, dst_y + y, ic);
-		}
-	}
+	Frame_DrawBitmap(pos * glyph_w, dst_y, glyph_w, glyph_h, get_glyph(pos, digit, dot));
 }
 
 void draw_str(const char *m, const char *dots, int dst_y)
 {
-	int pos = 0;
-	int dst_x = 0;
-
-	// pos 0 has only "-" 
-	int src_x = glyph_w * 16;
-	int src_y = (m[pos] == '-' || m[pos] == 'A' || m[pos] == 10) ? 32 : 0;
-
-	copy_glyph(src_x, src_y, dst_x, dst_y);
-	++pos;
-	dst_x += glyph_w;
-
-	for (; pos < 12; ++pos, dst_x += glyph_w) {
-		int src_x = get_glyph_src_x_int(m[pos]);
-        bool dot = dots[pos] != 0;
-
-		if (pos != 9) {
-			src_y = dot ? 32 : 0;
-			copy_glyph(src_x, src_y, dst_x, dst_y);
-		}
-		else {
-			// special half-digit with fat minus for exponent sign and advanced eggoggery
-			src_y = 64;
-			copy_glyph(src_x, src_y, dst_x, dst_y); // copy the top half
-		}
-
-		if (pos == 9 && dot) {
-			// copy dot at pos 9
-			src_y = 64 + glyph_dot_y;
-			src_x = 16 * glyph_w;
-			copy_glyph(src_x, src_y, dst_x, dst_y + glyph_dot_y, glyph_dot_h);
-		}
+	for (int pos = 0; pos < 12; ++pos) {
+		draw_digit(pos, m[pos], dots[pos] != 0, dst_y);
 	}
 }
 
@@ -111,6 +59,7 @@ void ILC2128L::begin()
 	Display_Init();
 	Display_SetOrienation(OLED_DISP_NORMAL);
 	wrbuf = 0;
+	shown_valid = false;
 }
 
 void ILC2128L::end()
@@ -153,8 +102,35 @@ void ILC2128L::flip_buffers()
 
 void ILC2128L::refresh()
 {
-    ++dither_frame;
-    Frame_Clear(0);
-    draw_str(display_chars[rdbuf()], display_dots[rdbuf()], OLED_HEIGHT / 2  - glyph_h / 2);
-	Display_SendFrame();
-}
\ No newline at end of file
+	// core0 may flip and write the buffer meanwhile: work on one copy,
+	// so what is recorded as shown is what was drawn
+	char chars[12];
+	char dots[12];
+	const int rd = rdbuf();
+	memcpy(chars, display_chars[rd], sizeof(chars));
+	memcpy(dots, display_dots[rd], sizeof(dots));
+
+	if (!shown_valid) {
+		Frame_Clear(0);
+		draw_str(chars, dots, glyph_dst_y);
+		Display_SendFrame();
+	}
+	else {
+		// redraw the digits that changed, send each run of them
+		int first = -1;
+		for (int pos = 0; pos <= 12; ++pos) {
+			if (pos < 12 && (chars[pos] != shown_chars[pos] || dots[pos] != shown_dots[pos])) {
+				draw_digit(pos, chars[pos], dots[pos] != 0, glyph_dst_y);
+				if (first < 0) first = pos;
+			}
+			else if (first >= 0) {
+				Display_SendRect(first * glyph_w, glyph_dst_y, (pos - first) * glyph_w, glyph_h);
+				first = -1;
+			}
+		}
+	}
+
+	memcpy(shown_chars, chars, sizeof(shown_chars));
+	memcpy(shown_dots, dots, sizeof(shown_dots));
+	shown_valid = true;
+}
@@ -22,6 +22,11 @@ private:
 
     int wrbuf = 0;
 
+    // what the panel shows, to send only the digits that changed
+    char shown_chars[12];
+    char shown_dots[12];
+    bool shown_valid = false;
+
     int rdbuf() const { return wrbuf^1; }
 
 public:
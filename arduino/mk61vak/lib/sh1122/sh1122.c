@@ -14,9 +14,16 @@
 
 #include "sh1122_hal.h"
 
-// Frame buffer
-static uint8_t FrameBuffer[OLED_WIDTH][OLED_HEIGHT] = {0};
-static uint8_t Buffer[OLED_WIDTH * OLED_HEIGHT / 2] = {0};
+// Frame buffers in the display RAM format: rows of OLED_STRIDE bytes,
+// 4 bits per pixel, left pixel in the high nibble. Sent as is.
+// One is drawn on while the other may still be going out: 2 x 8 KB of RAM.
+static uint8_t FrameBuffers[2][OLED_HEIGHT * OLED_STRIDE] = {0};
+static uint8_t *FrameBuffer = FrameBuffers[0];
+// Rows drawn since the last Display_SendFrame(), the other buffer lacks them
+static uint8_t DirtyTop = OLED_HEIGHT;
+static uint8_t DirtyBottom = 0;
+// Row address of the top line, see Display_SetOrienation()
+static uint8_t RowStart = 0;
 
 
 struct Gray_16_Color Display_Color = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
@@ -187,11 +194,22 @@ void SH1122_SetDischargeVSLLevel(uint8_t Value)
 }
 
 
+// Widen the rows drawn since the last send to [Top, Bottom)
+static inline void MarkRows(uint16_t Top, uint16_t Bottom)
+{
+    if (Top < DirtyTop)
+        DirtyTop = Top;
+    if (Bottom > DirtyBottom)
+        DirtyBottom = Bottom;
+}
+
 // Clear display internal RAM
 static void SH1122_ClearRAM(void)
 {
-    memset(Buffer, 0, sizeof(Buffer));
-    SH1122_WriteData(Buffer, OLED_WIDTH * OLED_HEIGHT / 2);
+    memset(FrameBuffers, 0, sizeof(FrameBuffers));
+    DirtyTop = OLED_HEIGHT;
+    DirtyBottom = 0;
+    SH1122_WriteData(FrameBuffer, OLED_HEIGHT * OLED_STRIDE);
 }
 
 //----------------------------------------------------------------------------------------
@@ -203,7 +221,8 @@ void Display_SetOrienation(uint8_t State)
 {
     if (State == OLED_DISP_ROTATE180)
     {
-        SH1122_SetRowAddress(32);
+        RowStart = 32;
+        SH1122_SetRowAddress(RowStart);
         SH1122_SetScanDirection(1);
         SH1122_SetSegmentRemap(1);
     }
@@ -221,23 +240,65 @@ void Display_Init(void)
     SH1122_SetDisPreChargePeriod(0xf1);
 }
 
-// Update display
+// Update display, returns while the frame is still being sent.
+// Drawing goes on in the other buffer, starting from the same picture:
+// only the rows drawn since the last send differ, only they are copied.
 void Display_SendFrame(void)
 {
-    for (uint32_t i = 0; i < OLED_HEIGHT; i++)
+    // Display_SendRect() may have left the address anywhere
+    SH1122_SetRowAddress(RowStart);
+    SH1122_SetColumnAddress(0);
+    SH1122_WriteDataAsync(FrameBuffer, OLED_HEIGHT * OLED_STRIDE);
+
+    uint8_t *Sent = FrameBuffer;
+    FrameBuffer = (Sent == FrameBuffers[0]) ? FrameBuffers[1] : FrameBuffers[0];
+    if (DirtyTop < DirtyBottom)
     {
-        for (uint32_t j = 0; j < OLED_WIDTH - 1; j = j + 2)
-        {
-            Buffer[(j + i * OLED_WIDTH) / 2] = (FrameBuffer[j][i] & 0xF0) | ((FrameBuffer[j + 1][i]) & 0x0F);
-        }
+        uint16_t Offset = DirtyTop * OLED_STRIDE;
+        memcpy(FrameBuffer + Offset, Sent + Offset, (DirtyBottom - DirtyTop) * OLED_STRIDE);
     }
+    DirtyTop = OLED_HEIGHT;
+    DirtyBottom = 0;
+}
 
-    SH1122_WriteData(Buffer, OLED_WIDTH * OLED_HEIGHT / 2);
+// Frame transfer still in progress
+uint8_t Display_Busy(void)
+{
+    return SH1122_Busy();
 }
 
+void Display_Wait(void)
+{
+    SH1122_Wait();
+}
+
+// Update a rectangle of the display, widened to whole bytes.
+// Each row needs its own address commands, so rows are sent one by one.
+void Display_SendRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if ((x >= OLED_WIDTH) || (y >= OLED_HEIGHT))
+        return;
+    if (x + w > OLED_WIDTH)
+        w = OLED_WIDTH - x;
+    if (y + h > OLED_HEIGHT)
+        h = OLED_HEIGHT - y;
+
+    uint16_t x1 = (x + w + 1) & ~1;
+    x &= ~1;
+
+    for (uint16_t i = y; i < y + h; i++)
+    {
+        SH1122_SetRowAddress((RowStart + i) & (OLED_HEIGHT - 1));
+        SH1122_SetColumnAddress(x / 2);
+        SH1122_WriteData(&FrameBuffer[i * OLED_STRIDE + x / 2], (x1 - x) / 2);
+    }
+}
+
+// Both pixels of a byte take their own nibble of the color
 void Frame_Clear(uint8_t color)
 {
-    memset(FrameBuffer, color, sizeof(FrameBuffer));
+    memset(FrameBuffer, color, OLED_HEIGHT * OLED_STRIDE);
+    MarkRows(0, OLED_HEIGHT);
 }
 
 // Draw a pixel in (x, y) coordinates
@@ -246,7 +307,51 @@ void Frame_DrawPixel(uint16_t x, uint16_t y, uint8_t color)
     if ((x >= OLED_WIDTH) || (y >= OLED_HEIGHT))
         return;
 
-    FrameBuffer[x][y] = color;
+    MarkRows(y, y + 1);
+    uint8_t *Byte = &FrameBuffer[y * OLED_STRIDE + x / 2];
+
+    if (x & 1)
+        *Byte = (*Byte & 0xF0) | (color & 0x0F);
+    else
+        *Byte = (*Byte & 0x0F) | (color & 0xF0);
+}
+
+// Draw a bitmap in the SH1122 RAM format: 4 bits per pixel, left pixel
+// in the high nibble; rows start at the byte holding pixel x
+void Frame_DrawBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *Bits)
+{
+    if ((x >= OLED_WIDTH) || (y >= OLED_HEIGHT) || (w == 0))
+        return;
+
+    const uint16_t Stride = ((x & 1) + w + 1) / 2;
+
+    if (x + w > OLED_WIDTH)
+        w = OLED_WIDTH - x;
+    if (y + h > OLED_HEIGHT)
+        h = OLED_HEIGHT - y;
+
+    MarkRows(y, y + h);
+
+    // Nibbles of the first and last byte that belong to the bitmap
+    const uint16_t Bytes = ((x & 1) + w + 1) / 2;
+    const uint8_t First = (x & 1) ? 0x0F : 0xFF;
+    const uint8_t Last = ((x + w) & 1) ? 0xF0 : 0xFF;
+
+    for (uint16_t i = 0; i < h; i++)
+    {
+        const uint8_t *Src = Bits + i * Stride;
+        uint8_t *Dst = &FrameBuffer[(y + i) * OLED_STRIDE + x / 2];
+
+        if (Bytes == 1)
+        {
+            uint8_t Mask = First & Last;
+            Dst[0] = (Dst[0] & ~Mask) | (Src[0] & Mask);
+            continue;
+        }
+        Dst[0] = (Dst[0] & ~First) | (Src[0] & First);
+        memcpy(Dst + 1, Src + 1, Bytes - 2);
+        Dst[Bytes - 1] = (Dst[Bytes - 1] & ~Last) | (Src[Bytes - 1] & Last);
+    }
 }
 
 // Draw a line from (x1, y1) to (x2, y2)
@@ -590,5 +695,7 @@ int16_t Frame_printf(uint16_t X, uint16_t Y, uint8_t FontID, uint8_t color, uint
 
 uint8_t* Frame_GetBuffer()
 {
-    return &FrameBuffer[0][0];
+    // The caller may write anywhere
+    MarkRows(0, OLED_HEIGHT);
+    return FrameBuffer;
 }
\ No newline at end of file
@@ -14,6 +14,8 @@
 // Display size
 #define OLED_WIDTH 256
 #define OLED_HEIGHT 64
+// Bytes per row of the frame buffer and of the display RAM
+#define OLED_STRIDE (OLED_WIDTH / 2)
 
 #define OLED_POWER_OFF 0
 #define OLED_POWER_ON 1
@@ -83,7 +85,7 @@ void SH1122_DisplayPower(uint8_t State);
 // 16: Set Display Offset
 void SH1122_SetDisplayOffset(uint8_t Value);
 // 25: Write Display Data
-void SH1122_WriteData(uint8_t *pData, uint32_t DataLen);
+void SH1122_WriteData(const uint8_t *pData, uint32_t DataLen);
 
 //----------------------------------------------------------------------------------------
 // High Level Display Functions
@@ -94,12 +96,22 @@ void SH1122_Config(int _pin_cs, int _pin_dc, int _pin_rst);
 void Display_SetOrienation(uint8_t State);
 // Init display
 void Display_Init();
-// Update display
+// Update display without waiting for the transfer to finish.
+// Two 8 KB frame buffers take turns; the rows drawn since the last
+// send are copied over so drawing continues on the same picture
 void Display_SendFrame(void);
+// Frame transfer in progress
+uint8_t Display_Busy(void);
+// Wait for the frame transfer to finish
+void Display_Wait(void);
+// Update a rectangle only
+void Display_SendRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 // Clear frame with color
 void Frame_Clear(uint8_t color);
 // Draw a pixel in (x, y) coordinates
 void Frame_DrawPixel(uint16_t x, uint16_t y, uint8_t color);
+// Draw a 4bpp bitmap packed like the display RAM
+void Frame_DrawBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *Bits);
 // Draw a line from (x1, y1) to (x2, y2)
 void Frame_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
 // Draw rectangle
@@ -115,6 +127,8 @@ int16_t Frame_DrawString(uint16_t X, uint16_t Y, uint8_t FontID, uint8_t *Str, u
 // Draw formatted string
 int16_t Frame_printf(uint16_t X, uint16_t Y, uint8_t FontID, uint8_t color, uint8_t hAlign, uint8_t vAlign, const char *args, ...);
 
+// Frame buffer: OLED_HEIGHT rows of OLED_STRIDE bytes, left pixel in the high nibble.
+// Changes after each Display_SendFrame(), get it again before writing to it
 uint8_t* Frame_GetBuffer();
 
 #ifdef __cplusplus
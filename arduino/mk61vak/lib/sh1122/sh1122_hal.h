@@ -17,7 +17,14 @@ void SH1122_Config(int _pin_cs, int _pin_dc, int _pin_rst);
 void SH1122_Reset(void);
 void SH1122_SendOneByteCommand(uint8_t cmd);
 void SH1122_SendDoubleByteCommand(uint8_t cmd_h, uint8_t cmd_l);
-void SH1122_WriteData(uint8_t *pData, uint32_t DataLen);
+void SH1122_WriteData(const uint8_t *pData, uint32_t DataLen);
+
+// Start sending data and return. The data must stay unchanged until
+// SH1122_Busy() returns 0; every other call waits for the transfer first.
+void SH1122_WriteDataAsync(const uint8_t *pData, uint32_t DataLen);
+int SH1122_Busy(void);
+void SH1122_Wait(void);
+
 void SH1122_Delay_Ms(int ms);
 
 
@@ -5,11 +5,23 @@
  Arduino-based HAL by svofski 2024
 
 */
+#ifdef ARDUINO
 
 #include <Arduino.h>
 #include <SPI.h>
 #include "sh1122_hal.h"
 
+#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_MBED_RP2040)
+#include <hardware/dma.h>
+#include <hardware/spi.h>
+#define HAVE_DMA 1
+
+// SCK 18 and MOSI 19 belong to SPI0
+static spi_inst_t *const spi_port = spi0;
+static int dma_chan = -1;
+static bool dma_active = false;
+#endif
+
 static int pin_cs = 17;
 static int pin_dc = 7;
 static int pin_rst = 6;
@@ -32,6 +44,7 @@ void SH1122_Config(int _pin_cs, int _pin_dc, int _pin_rst)
 
 void SH1122_Reset(void)
 {
+    SH1122_Wait();
     digitalWrite(pin_rst, 0);
     delay(10);
     digitalWrite(pin_rst, 1);
@@ -40,6 +53,7 @@ void SH1122_Reset(void)
 
 void SH1122_SendOneByteCommand(uint8_t cmd)
 {
+    SH1122_Wait();
     digitalWrite(pin_cs, 0);    // select oled
     digitalWrite(pin_dc, 0);    // command mode
     SPI.transfer(cmd);
@@ -48,6 +62,7 @@ void SH1122_SendOneByteCommand(uint8_t cmd)
 
 void SH1122_SendDoubleByteCommand(uint8_t cmd_h, uint8_t cmd_l)
 {
+    SH1122_Wait();
     digitalWrite(pin_cs, 0);    // select oled
     digitalWrite(pin_dc, 0);    // command mode
     SPI.transfer(cmd_h);
@@ -55,16 +70,72 @@ void SH1122_SendDoubleByteCommand(uint8_t cmd_h, uint8_t cmd_l)
     digitalWrite(pin_cs, 1);    // deselect oled
 }
 
-void SH1122_WriteData(uint8_t *pData, uint32_t DataLen)
+// The data is sent from the frame buffer itself: SPI.transfer(buf, len)
+// would overwrite it with whatever comes in on the unconnected MISO
+void SH1122_WriteData(const uint8_t *pData, uint32_t DataLen)
+{
+    SH1122_Wait();
+    digitalWrite(pin_cs, 0);    // select oled
+    digitalWrite(pin_dc, 1);    // data mode
+#if HAVE_DMA
+    spi_write_blocking(spi_port, pData, DataLen);
+#else
+    for (uint32_t i = 0; i < DataLen; i++)
+        SPI.transfer(pData[i]);
+#endif
+
+    digitalWrite(pin_cs, 1);    // deselect oled
+}
+
+// DMA feeds the SPI transmit FIFO; chip select stays low until it is done
+void SH1122_WriteDataAsync(const uint8_t *pData, uint32_t DataLen)
 {
+#if HAVE_DMA
+    SH1122_Wait();
+    if (dma_chan < 0)
+        dma_chan = dma_claim_unused_channel(true);
+
     digitalWrite(pin_cs, 0);    // select oled
     digitalWrite(pin_dc, 1);    // data mode
-    SPI.transfer(pData, DataLen);
+
+    dma_channel_config c = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_dreq(spi_port, true));
+    dma_channel_configure(dma_chan, &c, &spi_get_hw(spi_port)->dr, pData, DataLen, true);
+    dma_active = true;
+#else
+    SH1122_WriteData(pData, DataLen);
+#endif
+}
+
+int SH1122_Busy(void)
+{
+#if HAVE_DMA
+    if (!dma_active)
+        return 0;
+    if (dma_channel_is_busy(dma_chan) || spi_is_busy(spi_port))
+        return 1;
+
+    // Nothing was read back: drop what came in and the overrun it caused
+    while (spi_is_readable(spi_port))
+        (void) spi_get_hw(spi_port)->dr;
+    spi_get_hw(spi_port)->icr = SPI_SSPICR_RORIC_BITS;
 
     digitalWrite(pin_cs, 1);    // deselect oled
+    dma_active = false;
+#endif
+    return 0;
+}
+
+void SH1122_Wait(void)
+{
+    while (SH1122_Busy())
+        ;
 }
 
 void SH1122_Delay_Ms(int ms)
 {
     delay(ms);
-}
\ No newline at end of file
+}
+
+#endif
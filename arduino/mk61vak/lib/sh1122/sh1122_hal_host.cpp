@@ -0,0 +1,427 @@
+/*
+ SH1122 256x64 grayscale driver by Mikhail Tsaryov 
+ https://github.com/mikhail-tsaryov/SH1122-STM32-HAL-Driver
+
+ Host HAL by svofski 2024
+
+*/
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "sh1122_hal.h"
+#include "sh1122_hal_host.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define HAVE_SHM 1
+#endif
+
+#define RAM_ROWS 64
+#define RAM_COLUMNS 128         // Bytes, two pixels each
+#define PANEL_WIDTH (2 * RAM_COLUMNS)
+
+typedef std::chrono::steady_clock Clock;
+
+// Same clock as the Arduino HAL, unless limited for testing
+static double spi_hz = 20000000;
+static bool throttle = false;
+static Clock::time_point wire_free;     // Throttled: end of the last transfer
+
+// Asynchronous transfer, played by the worker thread
+static std::mutex async_lock;
+static std::condition_variable async_cv;
+static const uint8_t *async_data;
+static uint32_t async_len;
+static Clock::time_point async_done;
+static bool async_pending = false;
+static bool async_quit = false;
+
+// Controller state after reset
+static struct
+{
+    uint8_t ram[RAM_ROWS][RAM_COLUMNS];
+    uint8_t column;
+    uint8_t row;
+    uint8_t start_line;
+    uint8_t offset;
+    uint8_t contrast;
+    uint8_t remap;              // Segments right to left
+    uint8_t scan_reverse;       // COM63 to COM0
+    uint8_t entire_on;
+    uint8_t reverse;
+    uint8_t power;
+    uint8_t pending;            // First byte of a double-byte command, or 0
+} oled;
+
+static SH1122_HostStats stats;
+
+static SH1122_HostShared *shared;
+
+static void reset_registers()
+{
+    oled.column = 0;
+    oled.row = 0;
+    oled.start_line = 0;
+    oled.offset = 0;
+    oled.contrast = 0x80;
+    oled.remap = 0;
+    oled.scan_reverse = 0;
+    oled.entire_on = 0;
+    oled.reverse = 0;
+    oled.power = 0;
+    oled.pending = 0;
+}
+
+static void command(uint8_t cmd)
+{
+    ++stats.CommandBytes;
+
+    if (oled.pending) {
+        switch (oled.pending) {
+            case 0x81: oled.contrast = cmd; break;
+            case 0xB0: oled.row = cmd & (RAM_ROWS - 1); break;
+            case 0xD3: oled.offset = cmd & (RAM_ROWS - 1); break;
+            default: break;     // multiplex, DC-DC, clock, precharge, VCOM, VSEGM
+        }
+        oled.pending = 0;
+        return;
+    }
+
+    if (cmd <= 0x0F) {
+        oled.column = (oled.column & 0x70) | cmd;
+    }
+    else if (cmd <= 0x17) {
+        oled.column = ((cmd & 0x07) << 4) | (oled.column & 0x0F);
+    }
+    else if (cmd >= 0x40 && cmd <= 0x7F) {
+        oled.start_line = cmd & 0x3F;
+    }
+    else switch (cmd) {
+        case 0xA0: case 0xA1: oled.remap = cmd & 1; break;
+        case 0xA4: case 0xA5: oled.entire_on = cmd & 1; break;
+        case 0xA6: case 0xA7: oled.reverse = cmd & 1; break;
+        case 0xAE: case 0xAF: oled.power = cmd & 1; break;
+        case 0xC0: oled.scan_reverse = 0; break;
+        case 0xC8: oled.scan_reverse = 1; break;
+        case 0x81: case 0xA8: case 0xAD: case 0xB0: case 0xD3:
+        case 0xD5: case 0xD9: case 0xDB: case 0xDC:
+            oled.pending = cmd;
+            break;
+        default: break;         // discharge level and the rest
+    }
+}
+
+// Account a transfer; return when it would be off the wire
+static Clock::time_point transfer(uint32_t bytes)
+{
+    double seconds = bytes * 8 / spi_hz;
+
+    ++stats.Transfers;
+    stats.SpiSeconds += seconds;
+    if (!throttle)
+        return Clock::now();
+
+    Clock::time_point now = Clock::now();
+    if (wire_free < now)
+        wire_free = now;
+    wire_free += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+    return wire_free;
+}
+
+// The column address wraps to 0 at the end of a row and moves to the next row
+static void write_data(const uint8_t *pData, uint32_t DataLen)
+{
+    for (uint32_t i = 0; i < DataLen; ++i) {
+        oled.ram[oled.row][oled.column] = pData[i];
+        if (++oled.column == RAM_COLUMNS) {
+            oled.column = 0;
+            oled.row = (oled.row + 1) & (RAM_ROWS - 1);
+        }
+    }
+}
+
+static void worker()
+{
+    std::unique_lock<std::mutex> lock(async_lock);
+
+    for (;;) {
+        async_cv.wait(lock, [] { return async_pending || async_quit; });
+        if (!async_pending)
+            return;
+        lock.unlock();
+
+        // The caller leaves the controller alone until we are done
+        std::this_thread::sleep_until(async_done);
+        write_data(async_data, async_len);
+
+        lock.lock();
+        async_pending = false;
+        async_cv.notify_all();
+    }
+}
+
+// Started with the first asynchronous transfer, stopped at exit
+// before the lock and the condition it waits on go away
+static struct Worker
+{
+    std::thread thread;
+
+    ~Worker()
+    {
+        if (!thread.joinable())
+            return;
+        {
+            std::lock_guard<std::mutex> lock(async_lock);
+            async_quit = true;
+            async_cv.notify_all();
+        }
+        thread.join();
+    }
+} async_worker;
+
+void SH1122_Config(int _pin_cs, int _pin_dc, int _pin_rst)
+{
+}
+
+void SH1122_Reset(void)
+{
+    SH1122_Wait();
+    reset_registers();
+}
+
+void SH1122_SendOneByteCommand(uint8_t cmd)
+{
+    SH1122_Wait();
+    std::this_thread::sleep_until(transfer(1));
+    command(cmd);
+}
+
+void SH1122_SendDoubleByteCommand(uint8_t cmd_h, uint8_t cmd_l)
+{
+    SH1122_Wait();
+    std::this_thread::sleep_until(transfer(2));
+    command(cmd_h);
+    command(cmd_l);
+}
+
+void SH1122_WriteData(const uint8_t *pData, uint32_t DataLen)
+{
+    SH1122_Wait();
+    stats.DataBytes += DataLen;
+    std::this_thread::sleep_until(transfer(DataLen));
+    write_data(pData, DataLen);
+}
+
+void SH1122_WriteDataAsync(const uint8_t *pData, uint32_t DataLen)
+{
+    SH1122_Wait();
+    stats.DataBytes += DataLen;
+
+    std::lock_guard<std::mutex> lock(async_lock);
+    if (!async_worker.thread.joinable())
+        async_worker.thread = std::thread(worker);
+    async_data = pData;
+    async_len = DataLen;
+    async_done = transfer(DataLen);
+    async_pending = true;
+    async_cv.notify_all();
+}
+
+int SH1122_Busy(void)
+{
+    std::lock_guard<std::mutex> lock(async_lock);
+    return async_pending;
+}
+
+void SH1122_Wait(void)
+{
+    std::unique_lock<std::mutex> lock(async_lock);
+    async_cv.wait(lock, [] { return !async_pending; });
+}
+
+void SH1122_Delay_Ms(int ms)
+{
+}
+
+void SH1122_Host_LimitBandwidth(double Hz)
+{
+    SH1122_Wait();
+    throttle = Hz > 0;
+    spi_hz = throttle ? Hz : 20000000;
+    wire_free = Clock::now();
+}
+
+void SH1122_Host_GetStats(SH1122_HostStats *Stats)
+{
+    *Stats = stats;
+}
+
+void SH1122_Host_ResetStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+const uint8_t* SH1122_Host_GetRAM(void)
+{
+    SH1122_Wait();
+    return &oled.ram[0][0];
+}
+
+void SH1122_Host_Render(uint8_t *Pixels)
+{
+    SH1122_Wait();
+    for (int y = 0; y < RAM_ROWS; ++y) {
+        int com = oled.scan_reverse ? RAM_ROWS - 1 - y : y;
+        int row = (com + oled.start_line + oled.offset) & (RAM_ROWS - 1);
+
+        for (int x = 0; x < PANEL_WIDTH; ++x) {
+            int seg = oled.remap ? PANEL_WIDTH - 1 - x : x;
+            uint8_t byte = oled.ram[row][seg / 2];
+            int level = (seg & 1) ? byte & 0x0F : byte >> 4;
+
+            if (oled.entire_on)
+                level = 15;
+            if (oled.reverse)
+                level = 15 - level;
+            if (!oled.power)
+                level = 0;
+            Pixels[y * PANEL_WIDTH + x] = level * 17 * (oled.contrast + 1) / 256;
+        }
+    }
+}
+
+int SH1122_Host_SavePGM(const char *Path)
+{
+    uint8_t pixels[RAM_ROWS * PANEL_WIDTH];
+    FILE *f = fopen(Path, "wb");
+
+    if (!f)
+        return -1;
+    SH1122_Host_Render(pixels);
+    fprintf(f, "P5\n%d %d\n255\n", PANEL_WIDTH, RAM_ROWS);
+    fwrite(pixels, 1, sizeof(pixels), f);
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+static uint32_t crc32(uint32_t crc, const uint8_t *p, size_t n)
+{
+    crc = ~crc;
+    while (n--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; ++k)
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static void png_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t n)
+{
+    uint8_t head[8], tail[4];
+
+    put32(head, n);
+    memcpy(head + 4, type, 4);
+    put32(tail, crc32(crc32(0, head + 4, 4), data, n));
+    fwrite(head, 1, 8, f);
+    fwrite(data, 1, n, f);
+    fwrite(tail, 1, 4, f);
+}
+
+// 8-bit grayscale PNG, stored without compression: no zlib needed
+int SH1122_Host_SavePNG(const char *Path)
+{
+    enum { LINE = 1 + PANEL_WIDTH, RAW = RAM_ROWS * LINE };
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    uint8_t pixels[RAM_ROWS * PANEL_WIDTH];
+    uint8_t ihdr[13] = { 0 };
+    uint8_t raw[RAW];
+    uint8_t z[2 + 5 + RAW + 4];
+    uint32_t a = 1, b = 0;
+    FILE *f = fopen(Path, "wb");
+
+    if (!f)
+        return -1;
+    SH1122_Host_Render(pixels);
+
+    // Scanlines with filter type 0
+    for (int y = 0; y < RAM_ROWS; ++y) {
+        raw[y * LINE] = 0;
+        memcpy(&raw[y * LINE + 1], &pixels[y * PANEL_WIDTH], PANEL_WIDTH);
+    }
+
+    // zlib stream of one stored deflate block, then Adler-32
+    z[0] = 0x78;
+    z[1] = 0x01;
+    z[2] = 1;
+    z[3] = RAW & 0xFF;
+    z[4] = RAW >> 8;
+    z[5] = ~RAW & 0xFF;
+    z[6] = (~RAW >> 8) & 0xFF;
+    memcpy(z + 7, raw, RAW);
+    for (int i = 0; i < RAW; ++i) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    put32(z + 7 + RAW, b << 16 | a);
+
+    put32(ihdr, PANEL_WIDTH);
+    put32(ihdr + 4, RAM_ROWS);
+    ihdr[8] = 8;                // bit depth, grayscale
+    fwrite(signature, 1, sizeof(signature), f);
+    png_chunk(f, "IHDR", ihdr, sizeof(ihdr));
+    png_chunk(f, "IDAT", z, sizeof(z));
+    png_chunk(f, "IEND", 0, 0);
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+int SH1122_Host_OpenShared(const char *Name)
+{
+#ifdef HAVE_SHM
+    size_t size = sizeof(SH1122_HostShared) + RAM_ROWS * PANEL_WIDTH;
+    int fd = shm_open(Name, O_CREAT | O_RDWR, 0644);
+
+    if (fd < 0)
+        return -1;
+    if (ftruncate(fd, size) < 0) {
+        close(fd);
+        return -1;
+    }
+    void *p = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED)
+        return -1;
+
+    shared = (SH1122_HostShared *) p;
+    shared->Magic = SH1122_HOST_MAGIC;
+    shared->Width = PANEL_WIDTH;
+    shared->Height = RAM_ROWS;
+    shared->Frame = 0;
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+void SH1122_Host_Publish(void)
+{
+    if (shared) {
+        SH1122_Host_Render((uint8_t *) (shared + 1));
+        ++shared->Frame;
+    }
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ SH1122 256x64 grayscale driver by Mikhail Tsaryov 
+ https://github.com/mikhail-tsaryov/SH1122-STM32-HAL-Driver
+
+ Host HAL by svofski 2024
+
+ Simulated controller for running the display stack without hardware:
+ the command and data stream is decoded into display RAM, which can be
+ rendered the way the panel would show it and saved or shared.
+*/
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Counters since the last SH1122_Host_ResetStats()
+typedef struct
+{
+    uint32_t Transfers;         // Chip select cycles
+    uint32_t CommandBytes;
+    uint32_t DataBytes;
+    double SpiSeconds;          // Wire time at the SPI clock
+} SH1122_HostStats;
+
+// Make transfers take as long as they would at the given SPI clock,
+// asynchronous ones in a worker thread; 0 removes the limit.
+// Statistics use this clock too.
+void SH1122_Host_LimitBandwidth(double Hz);
+
+void SH1122_Host_GetStats(SH1122_HostStats *Stats);
+void SH1122_Host_ResetStats(void);
+
+// Display RAM as written: 64 rows of 128 bytes, left pixel in the high nibble
+const uint8_t* SH1122_Host_GetRAM(void);
+
+// The panel as seen: 64 rows of 256 8-bit gray pixels, after start line,
+// offset, scan direction, segment remap, contrast, reverse and power
+void SH1122_Host_Render(uint8_t *Pixels);
+
+// Save the rendered panel as binary PGM or as PNG. Return 0 on success.
+int SH1122_Host_SavePGM(const char *Path);
+int SH1122_Host_SavePNG(const char *Path);
+
+// Shared memory for a live viewer: a SH1122_HostShared header followed
+// by the rendered pixels, updated by SH1122_Host_Publish().
+// Return 0 on success, -1 where POSIX shared memory is missing.
+typedef struct
+{
+    uint32_t Magic;             // SH1122_HOST_MAGIC
+    uint16_t Width;
+    uint16_t Height;
+    uint32_t Frame;             // Incremented after each update
+} SH1122_HostShared;
+
+#define SH1122_HOST_MAGIC 0x32323153    // "S122"
+
+int SH1122_Host_OpenShared(const char *Name);
+void SH1122_Host_Publish(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,200 @@
+/*
+ * Batch runner for MK-61 programs.
+ *
+ * Every job gets its own calc_ctx_t cloned from a warmed-up template.
+ * Jobs are dealt round-robin to per-worker deques; a worker that runs
+ * dry steals from the front of the others.
+ */
+#ifndef ARDUINO
+
+#include "batch.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// Consecutive stopped steps after the last key before a job is done
+static constexpr unsigned STOP_STEPS = 2;
+
+static const int digit_keys[10] = {
+    KEY_0, KEY_1, KEY_2, KEY_3, KEY_4, KEY_5, KEY_6, KEY_7, KEY_8, KEY_9,
+};
+
+void batch_number_keys(std::vector<int> &keys, double value)
+{
+    char buf[32];
+
+    // d.ddddddde±XX: eight significant digits, like the display
+    snprintf(buf, sizeof(buf), "%.7e", value);
+
+    const char *p = buf;
+    bool neg = *p == '-';
+    if (neg) ++p;
+
+    keys.push_back(digit_keys[*p++ - '0']);
+    ++p;                                        // decimal point
+
+    const char *frac = p;
+    const char *end = p + 7;
+    while (end > frac && end[-1] == '0') --end;
+    if (end > frac) {
+        keys.push_back(KEY_DOT);
+        for (; p < end; ++p) keys.push_back(digit_keys[*p - '0']);
+    }
+    if (neg && value != 0) keys.push_back(KEY_NEG);
+
+    int exp = atoi(frac + 8);                   // skip "ddddddde"
+    if (value != 0 && exp != 0) {
+        int mag = exp < 0 ? -exp : exp;
+        keys.push_back(KEY_EXP);
+        if (mag >= 10) keys.push_back(digit_keys[mag / 10]);
+        keys.push_back(digit_keys[mag % 10]);
+        if (exp < 0) keys.push_back(KEY_NEG);
+    }
+}
+
+namespace {
+
+// One job in flight: context plus the key script it is typing
+struct Runner {
+    calc_ctx_t ctx;
+    std::vector<int> keys;
+    size_t pos = 0;
+
+    bool busy() { return pos < keys.size() || calc_ctx_keys_queued(&ctx); }
+
+    // Keep the input queue topped up; each key is held until the ROM
+    // takes it, and the next one waits until the ROM is ready again
+    void feed()
+    {
+        while (pos < keys.size() && calc_ctx_keys_queued(&ctx) < CALC_KEYQ_SIZE)
+            calc_ctx_press(&ctx, keys[pos++], CALC_HOLD_AUTO);
+    }
+};
+
+struct WorkQueue {
+    std::mutex lock;
+    std::deque<size_t> jobs;
+};
+
+// Take from the back of our own queue, or steal from the front of another
+bool next_job(std::vector<WorkQueue> &queues, unsigned self, size_t &job)
+{
+    {
+        std::lock_guard<std::mutex> g(queues[self].lock);
+        if (!queues[self].jobs.empty()) {
+            job = queues[self].jobs.back();
+            queues[self].jobs.pop_back();
+            return true;
+        }
+    }
+    for (unsigned i = 1; i < queues.size(); ++i) {
+        WorkQueue &victim = queues[(self + i) % queues.size()];
+        std::lock_guard<std::mutex> g(victim.lock);
+        if (!victim.jobs.empty()) {
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void run_job(const calc_ctx_t &tmpl, const BatchJob &job, BatchResult &res)
+{
+    Runner r;
+
+    r.ctx = tmpl;
+    calc_ctx_set_rgd(&r.ctx, MODE_RADIANS);
+
+    calc_ctx_write_code(&r.ctx, const_cast<unsigned char *>(job.code));
+
+    // Seed the registers directly instead of typing them
+    res.error = false;
+    if (job.regs_mask) {
+        unsigned char regs[DATA_NREGS][6];
+
+        calc_ctx_get_regs(&r.ctx, regs);
+        for (int i = 0; i < DATA_NREGS; ++i) {
+            if ((job.regs_mask & (1u << i)) &&
+                calc_value_from_double(job.regs[i], regs[i]) < 0)
+                res.error = true;
+        }
+        if (res.error) {
+            calc_ctx_get_stack(&r.ctx, res.stack);
+            calc_ctx_get_regs(&r.ctx, res.regs);
+            res.steps = 0;
+            res.timeout = false;
+            return;
+        }
+        calc_ctx_write_regs(&r.ctx, regs);
+    }
+    r.keys = job.keys;
+
+    unsigned steps = 0;
+    unsigned stopped = 0;
+    while (steps < job.max_steps) {
+        r.feed();
+        int running = calc_ctx_step(&r.ctx);
+        ++steps;
+        if (r.busy() || running)
+            stopped = 0;
+        else if (++stopped >= STOP_STEPS)
+            break;
+    }
+
+    calc_ctx_get_stack(&r.ctx, res.stack);
+    calc_ctx_get_regs(&r.ctx, res.regs);
+    res.steps = steps;
+    res.timeout = stopped < STOP_STEPS;
+}
+
+} // namespace
+
+BatchStats batch_run(const std::vector<BatchJob> &jobs,
+    std::vector<BatchResult> &results, unsigned nthreads)
+{
+    if (nthreads == 0)
+        nthreads = std::thread::hardware_concurrency();
+    if (nthreads == 0)
+        nthreads = 1;
+
+    results.resize(jobs.size());
+
+    // Decode the ROM sets here: plm_init() is not thread-safe on first use.
+    // Every job then starts from a copy of this powered-up calculator.
+    calc_ctx_t tmpl;
+    calc_ctx_init_fast(&tmpl);
+
+    std::vector<WorkQueue> queues(nthreads);
+    for (size_t i = 0; i < jobs.size(); ++i)
+        queues[i % nthreads].jobs.push_back(i);
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (unsigned w = 0; w < nthreads; ++w) {
+        workers.emplace_back([&, w] {
+            size_t job;
+            while (next_job(queues, w, job))
+                run_job(tmpl, jobs[job], results[job]);
+        });
+    }
+    for (auto &t : workers)
+        t.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    BatchStats stats;
+    stats.jobs = jobs.size();
+    stats.threads = nthreads;
+    stats.seconds = elapsed.count();
+    stats.per_sec_per_core = stats.seconds > 0 ?
+        jobs.size() / stats.seconds / nthreads : 0;
+    return stats;
+}
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ * Batch runner for MK-61 programs.
+ *
+ * Runs many independent calculator contexts on all cores.
+ * Host only.
+ */
+#pragma once
+
+#ifndef ARDUINO
+
+#include <cstdint>
+#include <vector>
+
+#include "mk61vak/calc.h"
+
+struct BatchJob {
+    unsigned char code[CODE_NBYTES];    // Program loaded with calc_ctx_write_code()
+    double regs[DATA_NREGS];            // Input register values
+    uint16_t regs_mask;                 // Bit n set: write regs[n] before running
+    std::vector<int> keys;              // KEY_* pressed after that, e.g. В/О С/П
+    unsigned max_steps;                 // calc_ctx_step() budget
+};
+
+struct BatchResult {
+    unsigned char stack[5][6];          // As returned by calc_ctx_get_stack()
+    unsigned char regs[DATA_NREGS][6];  // As returned by calc_ctx_get_regs()
+    unsigned steps;                     // calc_ctx_step() calls used
+    bool timeout;                       // Still busy when max_steps ran out
+    bool error;                         // A regs[] value is 1e100 or more: not run
+};
+
+struct BatchStats {
+    unsigned jobs;
+    unsigned threads;
+    double seconds;                     // Wall time of the whole batch
+    double per_sec_per_core;            // Programs per second per thread
+};
+
+//
+// Run all jobs, using nthreads workers (0: one per hardware thread).
+// results[] is resized to jobs.size(), in the same order.
+//
+BatchStats batch_run(const std::vector<BatchJob> &jobs,
+    std::vector<BatchResult> &results, unsigned nthreads = 0);
+
+//
+// Append the key sequence that types a number into X.
+//
+void batch_number_keys(std::vector<int> &keys, double value);
+
+#endif
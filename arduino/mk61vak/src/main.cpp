@@ -79,23 +79,10 @@ int ascii_to_mk(int c)
 }
 
 extern "C" {
+  // keys come through calc_press() in loop(), this is not polled
   int calc_keypad(void) 
   {
-      static int keycode = 0;
-      static int hold = 0;
-
-      if (Serial.available()) {
-        int c = Serial.read();
-        //printf("\nc=%d %x\n", c, c);
-        keycode = ascii_to_mk(c);
-        hold = 128; // make sure the key is held down long enough to be noticed
-        //Serial.print("keycode="); Serial.println(keycode);
-      }
-      if (hold) {
-        if (--hold == 0) 
-          keycode = 0;
-      }
-      return keycode;
+      return 0;
   }
 
   void calc_poll(void)
@@ -148,6 +135,37 @@ extern "C" {
       calc_display_vfd(i, digit, dot);
   }
 
+  // whole frames, delivered only when something changed
+  void calc_frame_vfd(calc_ctx_t *c, const calc_frame_t *f)
+  {
+      for (int i = 0; i < 12; ++i) {
+          ilc.set_digit(11 - i, f->digit[i] == -1 ? 0x0f : f->digit[i], f->dot[i] > 0);
+      }
+      ilc.flip_buffers();
+      multicore_fifo_push_blocking(1);
+  }
+
+  void calc_frame_term(calc_ctx_t *c, const calc_frame_t *f)
+  {
+      for (int i = 0; i < 12; ++i) {
+          termvfd.set_digit(11 - i, f->digit[i] == -1 ? 0x0f : f->digit[i], f->dot[i] > 0);
+      }
+      termvfd.flip_buffers();
+      termvfd.print_display();
+  }
+
+  // turbo mode: show the run indicator once instead of blinking it every step
+  void calc_running(int on)
+  {
+      if (on) {
+          for (int i = 0; i < 12; ++i) {
+              ilc.set_digit(i, 0x0f, 1);
+          }
+          ilc.flip_buffers();
+          multicore_fifo_push_blocking(1);
+      }
+  }
+
 }  // extern "C"
 
 void clear_display()
@@ -162,6 +180,9 @@ void clear_display()
 // just a heartbeat counter
 int core1_counter = 0;
 
+// replays the calculator's idle loop instead of simulating it
+static calc_idle_t calc_idle_tracker;
+
 void loop_core1()
 {
   for(;;) {
@@ -190,8 +211,12 @@ void setup() {
   ilc.flip_buffers();
   multicore_fifo_push_blocking(1);
 
-  // initialise the calculator
-  calc_init();
+  // initialise the calculator, already showing 0.
+  calc_init_fast();
+  calc_set_idle(&calc_idle_tracker);
+  calc_set_turbo(1);
+  calc_set_rgd(calc_rgd());
+  calc_ctx_set_frame(calc_get_ctx(), calc_frame_vfd);
 
   #if 0
   Serial.println("ik1302 cmd_rom:");
@@ -205,6 +230,15 @@ void setup() {
 
 void loop() {
   // put your main code here, to run repeatedly:
+  if (Serial.available() && calc_keys_queued() < CALC_KEYQ_SIZE) {
+    int c = Serial.read();
+    //printf("\nc=%d %x\n", c, c);
+    int keycode = ascii_to_mk(c);
+    if (keycode) {
+      // held until the calculator takes it, however busy it is
+      calc_press(keycode, CALC_HOLD_AUTO);
+    }
+  }
   calc_step();
 
   //Serial.println(core1_counter);
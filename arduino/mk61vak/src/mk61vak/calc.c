@@ -23,134 +23,801 @@
  * this software.
  */
 #include "calc.h"
+#include <stddef.h>
 #include <stdio.h>
+#include <string.h>
+#include <math.h>
 
 #include <stdint.h>
 
 #include "compat.h"
+
 //
-// MK-54 calculator consists of two PLM chips ИК1301 and ИК1303,
-// and two serial FIFOs К145ИР2.
+// Global context for the single-calculator API.
 //
-static plm_t ik1302, ik1303;
-static fifo_t fifo1, fifo2;
+static calc_ctx_t calc;
+
+//
+// Default context callbacks.
+//
+static int nop_keypad (calc_ctx_t *c)
+{
+    return 0;
+}
+
+static int nop_rgd (calc_ctx_t *c)
+{
+    return MODE_RADIANS;
+}
+
+static void nop_display (calc_ctx_t *c, int i, int digit, int dot)
+{
+}
+
+static void nop_poll (calc_ctx_t *c)
+{
+}
+
+static void nop_run (calc_ctx_t *c, int on)
+{
+}
 
-#ifndef MK_54
 //
-// MK-61 has an additional chip ИК1306 in series.
+// Callbacks of the global context: forward to user functions.
 //
-static plm_t ik1306;
+static int user_keypad (calc_ctx_t *c)
+{
+    return calc_keypad();
+}
+
+static int user_rgd (calc_ctx_t *c)
+{
+    return calc_rgd();
+}
+
+static void user_display (calc_ctx_t *c, int i, int digit, int dot)
+{
+    calc_display (i, digit, dot);
+}
+
+#ifndef CALC_NO_POLL
+static void user_poll (calc_ctx_t *c)
+{
+    calc_poll();
+}
 #endif
 
+static void user_run (calc_ctx_t *c, int on)
+{
+    calc_running (on);
+}
+
 //
-// Initialize the calculator.
+// Initialize the calculator context.
 //
-void calc_init()
+void calc_ctx_init (calc_ctx_t *c)
 {
     #include "ik1302.h"
     #include "ik1303.h"
+    #include "useq.h"
 
-    plm_init (&ik1302, ik1302_ucmd_rom, ik1302_cmd_rom, ik1302_prog_rom);
-    plm_init (&ik1303, ik1303_ucmd_rom, ik1303_cmd_rom, ik1303_prog_rom);
+    //
+    // MK-54 calculator consists of two PLM chips ИК1301 and ИК1303,
+    // and two serial FIFOs К145ИР2.
+    //
+    plm_init (&c->ik1302, ik1302_ucmd_rom, ik1302_cmd_rom, ik1302_prog_rom,
+        ik1302_useq_rom);
+    plm_init (&c->ik1303, ik1303_ucmd_rom, ik1303_cmd_rom, ik1303_prog_rom,
+        ik1303_useq_rom);
 
 #ifndef MK_54
+    //
+    // MK-61 has an additional chip ИК1306 in series.
+    //
     #include "ik1306.h"
-    plm_init (&ik1306, ik1306_ucmd_rom, ik1306_cmd_rom, ik1306_prog_rom);
+    plm_init (&c->ik1306, ik1306_ucmd_rom, ik1306_cmd_rom, ik1306_prog_rom,
+        ik1306_useq_rom);
 #endif
-    fifo_init (&fifo1);
-    fifo_init (&fifo2);
+    fifo_init (&c->fifo1);
+    fifo_init (&c->fifo2);
+
+    c->keypad = nop_keypad;
+    c->rgd = nop_rgd;
+    c->display = nop_display;
+    c->poll = nop_poll;
+    c->run = nop_run;
+    c->frame = 0;
+    c->user = 0;
+    c->idle = 0;
+    c->cycles = 0;
+    c->turbo = 0;
+    c->running = 0;
+    c->poll_cadence = CALC_POLL_WORD;
+    c->input = 0;
+    c->rgd_mode = MODE_RADIANS;
+    c->keyq.head = 0;
+    c->keyq.count = 0;
+    c->keyq.settle = 0;
+    c->view.stack_cycles = CALC_VIEW_STALE;
+    c->view.reg_cycles = CALC_VIEW_STALE;
 }
 
+#ifdef PLM_COMPILED
+#define PLM_WORDS(chip) chip##_words
+#else
+#define PLM_WORDS(chip) 0
+#endif
+
 //
-// Simulate one cycle of the calculator.
-// Return 0 when stopped, or 1 when running a user program.
-// Fill digit[] and dit[] arrays with the indicator contents.
+// Run one word of a PLM chip: through compiled code when
+// there is some for the instruction, else interpreted.
 //
-int calc_step()
+static void plm_word (plm_t *t, const plm_word_t words[],
+    const uint8_t in[], uint8_t out[])
 {
-    int k, i, digit, dot;
-    unsigned cycle;
+#if defined(PLM_COMPILED) || defined(PLM_JIT)
+    unsigned pc = nib_get (t->R, 36) + (nib_get (t->R, 39) << 4);
+#ifdef PLM_COMPILED
+    plm_word_t run = words[pc];
+#else
+    plm_word_t run = plm_jit_enabled() ? plm_jit_word (t->rom, pc) : 0;
+#endif
 
-    for (k=0; k<560; k++) {
-        // Scan keypad.
-        i = calc_keypad();
-        ik1302.keyb_x = i >> 4;
-        ik1302.keyb_y = i & 0xf;
-        ik1303.keyb_x = calc_rgd();
-        ik1303.keyb_y = 1;
+    if (run) {
+        t->command = pgm_read_dword_near(&t->cmd_rom[pc]);
+        t->useq = t->rom->useq[pc];
+        if ((t->command & 0xfc0000) == 0)
+            t->keypad_event = 0;
 
-        // Do computations.
-        for (cycle=0; cycle<REG_NWORDS; cycle++) {
-            calc_poll();
-            ik1302.input = fifo2.output;
-            plm_step (&ik1302, cycle);
-            ik1303.input = ik1302.output;
-            plm_step (&ik1303, cycle);
+        run (t, in, out);
+        t->input = in[REG_NWORDS-1];
+        t->output = out[REG_NWORDS-1];
+        return;
+    }
+#endif
+    plm_step_word (t, in, out);
+}
+
+//
+// Run one word of a FIFO chip.
+// The cycle counter stays word aligned, so the word never wraps.
+//
+static void fifo_word (fifo_t *t, const uint8_t in[], uint8_t out[])
+{
+    unsigned i;
+
+    for (i=0; i<REG_NWORDS; i++) {
+        out[i] = nib_get (t->data, t->cycle + i);
+        nib_set (t->data, t->cycle + i, in[i]);
+    }
+    t->input = in[REG_NWORDS-1];
+    t->output = out[REG_NWORDS-1];
+    t->cycle += REG_NWORDS;
+    if (t->cycle >= FIFO_NWORDS)
+        t->cycle = 0;
+}
+
+//
+// Simulate one word of the whole ring: ИК1302, ИК1303, ИК1306,
+// then both ИР2, each chip running its 42 cycles in one go.
+// The FIFOs delay by more than a word, so no chip needs
+// the output of a later one within the same word: ik1302 sees
+// the old FIFO2 contents, which a cycle by cycle simulation
+// copies into its M register.
+//
+static void ring_word (calc_ctx_t *c)
+{
+    uint8_t a [REG_NWORDS], b [REG_NWORDS], o2 [REG_NWORDS];
+    unsigned i;
+
+    for (i=0; i<REG_NWORDS; i++)
+        o2[i] = nib_get (c->fifo2.data, c->fifo2.cycle + i);
+    plm_word (&c->ik1302, PLM_WORDS(ik1302), o2, a);
+    c->ik1302.input = o2[REG_NWORDS-2];
 #ifdef MK_54
-            fifo1.input = ik1303.output;
+    plm_word (&c->ik1303, PLM_WORDS(ik1303), a, b);
+    fifo_word (&c->fifo1, b, a);
+    fifo_word (&c->fifo2, a, o2);
 #else
-            ik1306.input = ik1303.output;
-            plm_step (&ik1306, cycle);
-            fifo1.input = ik1306.output;
+    plm_word (&c->ik1303, PLM_WORDS(ik1303), a, b);
+    plm_word (&c->ik1306, PLM_WORDS(ik1306), b, a);
+    fifo_word (&c->fifo1, a, b);
+    fifo_word (&c->fifo2, b, o2);
+#endif
+}
+
+//
+// Bytes of calc_ctx_t holding the machine, ahead of the callbacks.
+//
+#define CALC_STATE_SIZE offsetof(calc_ctx_t, keypad)
+
+//
+// Marks an automatic hold waiting for the ROM after the key latched.
+//
+#define KEYQ_SETTLE     (~1u)
+
+//
+// Next key of the queue, for one word.
+// An event is dropped as soon as its last word is played.
+//
+static inline int queued_key (calc_keyq_t *q)
+{
+    int key;
+
+    while (q->count > 0 && q->hold [q->head] == 0) {
+        q->head = (q->head + 1) % CALC_KEYQ_SIZE;
+        q->count--;
+    }
+    if (q->count == 0)
+        return 0;
+
+    key = q->key [q->head];
+    if (q->hold [q->head] >= KEYQ_SETTLE) {
+        // Automatic hold: see queued_word().
+        return key;
+    }
+    if (--q->hold [q->head] == 0) {
+        q->head = (q->head + 1) % CALC_KEYQ_SIZE;
+        q->count--;
+    }
+    return key;
+}
+
+//
+// Follow an automatic hold after each word.
+// The ROM takes a key only while it shows the display, and only
+// after it saw the keypad released there. So the key is held until
+// the scan latched it with the display on, then released until the
+// display was on for CALC_KEY_SETTLE words with no key seen.
+//
+static inline void queued_word (calc_ctx_t *c, int shown)
+{
+    calc_keyq_t *q = &c->keyq;
+
+    if (q->count == 0 || q->hold [q->head] < KEYQ_SETTLE)
+        return;
+
+    if (q->hold [q->head] == CALC_HOLD_AUTO) {
+        if (shown && c->ik1302.keypad_event) {
+            q->key [q->head] = 0;
+            q->hold [q->head] = KEYQ_SETTLE;
+            q->settle = 0;
+        }
+    } else if (! shown || c->ik1302.keypad_event) {
+        q->settle = 0;
+    } else if (++q->settle >= CALC_KEY_SETTLE) {
+        q->head = (q->head + 1) % CALC_KEYQ_SIZE;
+        q->count--;
+    }
+}
+
+//
+// Poll keypad and rgd switch for one word:
+// from the queue when input is set, else through the callbacks.
+//
+static inline void poll_input (calc_ctx_t *c, int *key, int *rgd)
+{
+    if (c->input) {
+        *key = queued_key (&c->keyq);
+        *rgd = c->rgd_mode;
+    } else {
+        *key = c->keypad (c);
+        *rgd = c->rgd (c);
+    }
+}
+
+//
+// Pass one display symbol on: to the display callback,
+// or into the frame, delivered when complete and changed.
+// i < 0 clears the display between scans.
+//
+static void show (calc_ctx_t *c, int i, int digit, int dot, int blink)
+{
+    calc_frame_t *f = &c->frame_next;
+
+    if (! c->frame) {
+        c->display (c, i, digit, dot);
+        return;
+    }
+    if (i < 0)
+        return;
+    f->digit [i] = blink ? -1 : digit;
+    f->dot [i] = dot;
+    if (i == 11) {
+        f->blink = blink;
+        if (memcmp (f, &c->frame_shown, sizeof *f) != 0) {
+            c->frame_shown = *f;
+            c->frame (c, f);
+        }
+    }
+}
+
+//
+// Show the display symbol of word k of a step.
+// With quiet set, only update the machine, without the callback.
+// Store the symbol into *sym when not null, see idle_step().
+//
+static void display_word (calc_ctx_t *c, int k, int quiet, uint8_t *sym)
+{
+    int i, digit, dot;
+
+    i = k % 14;
+    if (i >= 12) {
+        // Clear display.
+        if (! quiet)
+            show (c, -1, 0, 0, 0);
+        return;
+    }
+    if (i < 3) {
+        // Exponent.
+        digit = nib_get (c->ik1302.R, (i + 9) * 3);
+        dot = c->ik1302.show_dot [i + 10];
+    } else {
+        // Mantissa.
+        digit = nib_get (c->ik1302.R, (i - 3) * 3);
+        dot = c->ik1302.show_dot [i - 2];
+    }
+
+    if (c->ik1302.dot == 11) {
+        // Run mode: blink once per step with dots enabled.
+        if (c->ik1302.command != 0x00117360)
+            digit = -1;
+        dot = 1;
+    } else if (c->ik1302.enable_display) {
+        // Manual mode.
+        c->ik1302.enable_display = 0;
+    } else {
+        // Clear display.
+        digit = -1;
+        dot = -1;
+    }
+    if (! quiet)
+        show (c, i, digit, dot, c->ik1302.dot == 11);
+    if (sym)
+        *sym = (digit + 1) | (dot + 1) << 5;
+}
+
+//
+// Simulate words from...559 of a step, polling the callbacks.
+// When key >= 0, keypad and rgd were already polled for word 'from'.
+// Record the step into the idle tracker, if any.
+// Return 0 when stopped, or 1 when running a user program.
+//
+static int run_words (calc_ctx_t *c, int from, int key, int rgd)
+{
+    calc_idle_t *idle = c->idle;
+    uint8_t *log = 0;
+    int k, quiet = 0;
+#if 0
+    int i, digit, dot;
 #endif
-            fifo_step (&fifo1);
-            fifo2.input = fifo1.output;
-            fifo_step (&fifo2);
-            ik1302.M[cycle] = fifo2.output;
+
+    if (idle) {
+        if (from == 0) {
+            log = idle->display [idle->count % CALC_IDLE_STEPS];
+            memcpy (&idle->state [idle->count % CALC_IDLE_STEPS], c, CALC_STATE_SIZE);
+        } else {
+            idle->count = 0;
+        }
+    }
+
+    for (k=from; k<560; k++) {
+        // Scan keypad.
+        if (k != from || key < 0)
+            poll_input (c, &key, &rgd);
+        c->ik1302.keyb_x = key >> 4;
+        c->ik1302.keyb_y = key & 0xf;
+        c->ik1303.keyb_x = rgd;
+        c->ik1303.keyb_y = 1;
+
+        if (log) {
+            // A step with any input cannot be replayed.
+            if (k == 0 && idle->count == 0)
+                idle->rgd = rgd;
+            if (key != 0 || rgd != idle->rgd)
+                log = 0;
         }
+
+        // Do computations.
+#ifndef CALC_NO_POLL
+        if (c->poll_cadence == CALC_POLL_WORD)
+            c->poll (c);
+#endif
+        ring_word (c);
+        c->cycles += REG_NWORDS;
+        if (c->input)
+            queued_word (c, c->ik1302.enable_display);
 #if 0
         // Debug trace.
-        if (ik1302.dot == 11 && k%14 == 0) {
+        if (c->ik1302.dot == 11 && k%14 == 0) {
             printf ("             %-2u :", k/14);
             for (i=0; i<12; i++) {
                 if (11-i < 3) {
                     // Exponent.
-                    digit = ik1302.R [(11-i + 9) * 3];
-                    dot = ik1302.show_dot [11-i + 10];
+                    digit = nib_get (c->ik1302.R, (11-i + 9) * 3);
+                    dot = c->ik1302.show_dot [11-i + 10];
                 } else {
                     // Mantissa.
-                    digit = ik1302.R [(11-i - 3) * 3];
-                    dot = ik1302.show_dot [11-i - 2];
+                    digit = nib_get (c->ik1302.R, (11-i - 3) * 3);
+                    dot = c->ik1302.show_dot [11-i - 2];
                 }
                 putchar ("0123456789-LCRE " [digit]);
                 if (dot)
                     putchar ('.');
             }
-            printf ("' (%x %x) %08x\n", ik1302.R[39], ik1302.R[36], ik1302.command);
+            printf ("' (%x %x) %08x\n", nib_get (c->ik1302.R, 39),
+                nib_get (c->ik1302.R, 36), c->ik1302.command);
         }
 #endif
 
-        i = k % 14;
-        if (i >= 12) {
-            // Clear display.
-            calc_display (-1, 0, 0);
-        } else {
-            if (i < 3) {
-                // Exponent.
-                digit = ik1302.R [(i + 9) * 3];
-                dot = ik1302.show_dot [i + 10];
-            } else {
-                // Mantissa.
-                digit = ik1302.R [(i - 3) * 3];
-                dot = ik1302.show_dot [i - 2];
+        if (c->turbo) {
+            // Tell once about run mode, instead of every digit.
+            quiet = (c->ik1302.dot == 11);
+            if (quiet != c->running) {
+                c->running = quiet;
+                c->run (c, quiet);
+
+                // The run callback drew over the last frame.
+                memset (&c->frame_shown, 0x7f, sizeof c->frame_shown);
             }
+        }
+        display_word (c, k, quiet, log ? &log[k] : 0);
+    }
+
+    if (idle) {
+        if (log && c->ik1302.dot != 11)
+            idle->count++;
+        else
+            idle->count = 0;
+    }
+    return (c->ik1302.dot == 11);
+}
+
+//
+// Replay one step of a recorded idle cycle.
+// The callbacks are polled as usual; on any input the machine
+// goes back to the start of the step, silently catches up with
+// the words already shown, and simulates the rest.
+//
+static int idle_step (calc_ctx_t *c)
+{
+    calc_idle_t *idle = c->idle;
+    unsigned phase = idle->phase;
+    const uint8_t *log = idle->display [phase];
+    int k, w, key, rgd, sym;
 
-            if (ik1302.dot == 11) {
-                // Run mode: blink once per step with dots enabled.
-                if (ik1302.command != 0x00117360)
-                    digit = -1;
-                calc_display (i, digit, 1);
-            } else if (ik1302.enable_display) {
-                // Manual mode.
-                calc_display (i, digit, dot);
-                ik1302.enable_display = 0;
-            } else {
-                // Clear display.
-                calc_display (i, -1, -1);
+    for (k=0; k<560; k++) {
+        poll_input (c, &key, &rgd);
+        if (key != 0 || rgd != idle->rgd) {
+            idle->replay = 0;
+            memcpy (c, &idle->state [phase], CALC_STATE_SIZE);
+            for (w=0; w<k; w++) {
+                c->ik1302.keyb_x = 0;
+                c->ik1302.keyb_y = 0;
+                c->ik1303.keyb_x = idle->rgd;
+                c->ik1303.keyb_y = 1;
+                ring_word (c);
+                display_word (c, w, 1, 0);
             }
+            return run_words (c, k, key, rgd);
+        }
+#ifndef CALC_NO_POLL
+        if (c->poll_cadence == CALC_POLL_WORD)
+            c->poll (c);
+#endif
+        c->cycles += REG_NWORDS;
+        if (c->input) {
+            // Replaying: the ROM waits for a key.
+            queued_word (c, 1);
+        }
+        if (k % 14 >= 12) {
+            show (c, -1, 0, 0, 0);
+        } else {
+            sym = log[k];
+            show (c, k % 14, (sym & 0x1f) - 1, (sym >> 5) - 1, 0);
         }
     }
-    return (ik1302.dot == 11);
+    idle->phase = (phase + 1) % CALC_IDLE_STEPS;
+    memcpy (c, &idle->state [idle->phase], CALC_STATE_SIZE);
+    return 0;
+}
+
+//
+// Simulate one cycle of the calculator context.
+// Return 0 when stopped, or 1 when running a user program.
+// Call keypad, rgd and display callbacks of the context.
+//
+int calc_ctx_step (calc_ctx_t *c)
+{
+    calc_idle_t *idle = c->idle;
+    int running;
+
+#ifndef CALC_NO_POLL
+    if (c->poll_cadence == CALC_POLL_STEP)
+        c->poll (c);
+#endif
+    if (idle && idle->replay)
+        return idle_step (c);
+
+    running = run_words (c, 0, -1, 0);
+
+    // Three quiet steps bring the FIFOs back in phase: when the
+    // machine is back at the start of the first, it is in a loop.
+    if (idle && idle->count >= CALC_IDLE_STEPS) {
+        unsigned phase = idle->count % CALC_IDLE_STEPS;
+        if (memcmp (c, &idle->state [phase], CALC_STATE_SIZE) == 0) {
+            idle->replay = 1;
+            idle->phase = phase;
+        }
+    }
+    return running;
+}
+
+//
+// Enable idle fast-forward with the given tracker, or disable with 0.
+//
+void calc_ctx_set_idle (calc_ctx_t *c, calc_idle_t *idle)
+{
+    c->idle = idle;
+    if (idle) {
+        idle->count = 0;
+        idle->replay = 0;
+    }
+}
+
+int calc_ctx_idle (calc_ctx_t *c)
+{
+    return c->idle && c->idle->replay;
+}
+
+//
+// Enable or disable turbo run mode.
+//
+void calc_ctx_set_turbo (calc_ctx_t *c, int on)
+{
+    c->turbo = (on != 0);
+    if (! c->turbo && c->running) {
+        c->running = 0;
+        c->run (c, 0);
+    }
+}
+
+uint64_t calc_ctx_cycles (calc_ctx_t *c)
+{
+    return c->cycles;
+}
+
+//
+// Switch to frame-level display, or back with 0.
+// The next complete frame is delivered whatever it shows.
+//
+void calc_ctx_set_frame (calc_ctx_t *c,
+    void (*frame) (calc_ctx_t *c, const calc_frame_t *f))
+{
+    c->frame = frame;
+    memset (&c->frame_shown, 0x7f, sizeof c->frame_shown);
+}
+
+//
+// Set how often the poll callback is called.
+//
+void calc_ctx_set_poll (calc_ctx_t *c, int cadence)
+{
+    c->poll_cadence = cadence;
+}
+
+//
+// Queue a key event.
+//
+int calc_ctx_press (calc_ctx_t *c, int key, unsigned hold_words)
+{
+    calc_keyq_t *q = &c->keyq;
+    unsigned i;
+
+    c->input = 1;
+    if (q->count >= CALC_KEYQ_SIZE)
+        return -1;
+    if (key == 0 && hold_words == CALC_HOLD_AUTO)
+        hold_words = CALC_KEY_SETTLE;
+    else if (hold_words == KEYQ_SETTLE)
+        hold_words--;                   // Fixed, however long
+    i = (q->head + q->count) % CALC_KEYQ_SIZE;
+    q->key [i] = key;
+    q->hold [i] = hold_words;
+    q->count++;
+    return 0;
+}
+
+//
+// Set the radians/grads/degrees switch.
+//
+void calc_ctx_set_rgd (calc_ctx_t *c, int mode)
+{
+    c->input = 1;
+    c->rgd_mode = mode;
+}
+
+unsigned calc_ctx_keys_queued (calc_ctx_t *c)
+{
+    return c->keyq.count;
+}
+
+//
+// Initialize the calculator.
+//
+void calc_init()
+{
+    calc_ctx_init (&calc);
+    calc.keypad = user_keypad;
+    calc.rgd = user_rgd;
+    calc.display = user_display;
+#ifndef CALC_NO_POLL
+    calc.poll = user_poll;
+#endif
+    calc.run = user_run;
+}
+
+//
+// Simulate one cycle of the calculator.
+// Return 0 when stopped, or 1 when running a user program.
+//
+int calc_step()
+{
+    return calc_ctx_step (&calc);
+}
+
+calc_ctx_t *calc_get_ctx()
+{
+    return &calc;
+}
+
+void calc_set_idle (calc_idle_t *idle)
+{
+    calc_ctx_set_idle (&calc, idle);
+}
+
+int calc_idle()
+{
+    return calc_ctx_idle (&calc);
+}
+
+void calc_set_turbo (int on)
+{
+    calc_ctx_set_turbo (&calc, on);
+}
+
+void calc_set_poll (int cadence)
+{
+    calc_ctx_set_poll (&calc, cadence);
+}
+
+uint64_t calc_cycles()
+{
+    return calc_ctx_cycles (&calc);
+}
+
+int calc_press (int key, unsigned hold_words)
+{
+    return calc_ctx_press (&calc, key, hold_words);
+}
+
+void calc_set_rgd (int mode)
+{
+    calc_ctx_set_rgd (&calc, mode);
+}
+
+unsigned calc_keys_queued()
+{
+    return calc_ctx_keys_queued (&calc);
+}
+
+#ifdef MK_54
+#define CALC_SAVE_MODEL 54
+#else
+#define CALC_SAVE_MODEL 61
+#endif
+
+//
+// Save the machine state: a header, then every chip in ring order.
+//
+size_t calc_ctx_save_state (calc_ctx_t *c, uint8_t buf[])
+{
+    uint8_t *p = buf;
+
+    *p++ = 'M';
+    *p++ = 'K';
+    *p++ = CALC_SAVE_VERSION;
+    *p++ = CALC_SAVE_MODEL;
+    plm_save (&c->ik1302, p);
+    p += PLM_STATE_SIZE;
+    plm_save (&c->ik1303, p);
+    p += PLM_STATE_SIZE;
+#ifndef MK_54
+    plm_save (&c->ik1306, p);
+    p += PLM_STATE_SIZE;
+#endif
+    fifo_save (&c->fifo1, p);
+    p += FIFO_STATE_SIZE;
+    fifo_save (&c->fifo2, p);
+    p += FIFO_STATE_SIZE;
+    return p - buf;
+}
+
+//
+// Load the machine state saved by calc_ctx_save_state().
+// The idle tracker starts over.
+//
+int calc_ctx_load_state (calc_ctx_t *c, const uint8_t buf[], size_t size)
+{
+    const uint8_t *p;
+    fifo_t fifo1, fifo2;
+
+    if (size != CALC_SAVE_SIZE || buf[0] != 'M' || buf[1] != 'K' ||
+        buf[2] != CALC_SAVE_VERSION || buf[3] != CALC_SAVE_MODEL)
+        return -1;
+
+    // The FIFOs step together from power-on
+    p = buf + 4 + PLM_NROMS*PLM_STATE_SIZE;
+    if (fifo_load (&fifo1, p) < 0 ||
+        fifo_load (&fifo2, p + FIFO_STATE_SIZE) < 0 ||
+        fifo1.cycle != fifo2.cycle)
+        return -1;
+
+    p = buf + 4;
+    plm_load (&c->ik1302, p);
+    p += PLM_STATE_SIZE;
+    plm_load (&c->ik1303, p);
+    p += PLM_STATE_SIZE;
+#ifndef MK_54
+    plm_load (&c->ik1306, p);
+#endif
+    c->fifo1 = fifo1;
+    c->fifo2 = fifo2;
+    calc_ctx_changed (c);
+    return 0;
+}
+
+//
+// Bring a freshly initialized context to its idle loop: load the
+// snapshot made by tools/bootgen.c, or step there when it does not
+// fit this build.
+//
+static void boot (calc_ctx_t *c)
+{
+    #include "boot.h"
+    uint8_t buf [sizeof (calc_boot_state)];
+    unsigned i;
+
+    for (i=0; i<sizeof (buf); i++)
+        buf[i] = pgm_read_byte (&calc_boot_state[i]);
+    if (calc_ctx_load_state (c, buf, sizeof (buf)) == 0) {
+        c->cycles = (uint64_t) CALC_BOOT_STEPS * 560 * REG_NWORDS;
+        return;
+    }
+    for (i=0; i<CALC_BOOT_STEPS; i++)
+        calc_ctx_step (c);
+}
+
+void calc_ctx_init_fast (calc_ctx_t *c)
+{
+    calc_ctx_init (c);
+    boot (c);
+}
+
+size_t calc_save_state (uint8_t buf[])
+{
+    return calc_ctx_save_state (&calc, buf);
+}
+
+int calc_load_state (const uint8_t buf[], size_t size)
+{
+    return calc_ctx_load_state (&calc, buf, size);
+}
+
+void calc_init_fast()
+{
+    calc_init();
+    boot (&calc);
 }
 
 typedef struct {
@@ -203,17 +870,17 @@ static const unsigned char remap_stack[3][5] = {
 #endif
 
 //
-// Get the base address of chip memory.
+// Get the base address of chip memory, for nib_get() and nib_set().
 //
-static unsigned char *chip_base (unsigned chip)
+static unsigned char *chip_base (calc_ctx_t *c, unsigned chip)
 {
     switch (chip) {
-    case 1: return fifo1.data;
-    case 2: return fifo2.data;
-    case 3: return ik1302.M;
-    case 4: return ik1303.M;
+    case 1: return c->fifo1.data;
+    case 2: return c->fifo2.data;
+    case 3: return c->ik1302.M;
+    case 4: return c->ik1303.M;
 #ifndef MK_54
-    case 5: return ik1306.M;
+    case 5: return c->ik1306.M;
 #endif
     }
     return 0;
@@ -222,15 +889,16 @@ static unsigned char *chip_base (unsigned chip)
 //
 // Extract stack and register values from the serial shift registers.
 //
-static void fetch_value (unsigned char result[], unsigned chip, unsigned address)
+static void fetch_value (calc_ctx_t *c, unsigned char result[],
+    unsigned chip, unsigned address)
 {
-    unsigned char *data = chip_base(chip);
+    unsigned char *data = chip_base(c, chip);
     int i;
 
     if (data) {
-        data += address;
-        for (i=0; i<6; i++, data-=6)
-            result[i] = data[0] | data[-3] << 4;
+        for (i=0; i<6; i++, address-=6)
+            result[i] = nib_get (data, address) |
+                        nib_get (data, address - 3) << 4;
     } else {
         for (i=0; i<6; i++)
             result[i] = 0;
@@ -240,38 +908,38 @@ static void fetch_value (unsigned char result[], unsigned chip, unsigned address
 //
 // Extract stack values from the serial shift registers.
 //
-void calc_get_stack (unsigned char stack[5][6])
+void calc_ctx_get_stack (calc_ctx_t *c, unsigned char stack[][6])
 {
-    int phase = fifo1.cycle / (2*REG_NWORDS);
+    int phase = c->fifo1.cycle / (2*REG_NWORDS);
     int i;
 
     for (i=0; i<5; i++) {
         location_t loc = stack_map[remap_stack[phase][i]];
-        fetch_value (stack[i], loc.chip, loc.address);
+        fetch_value (c, stack[i], loc.chip, loc.address);
     }
 }
 
 //
 // Extract memory register values from the serial shift registers.
 //
-void calc_get_regs (unsigned char reg[][6])
+void calc_ctx_get_regs (calc_ctx_t *c, unsigned char reg[][6])
 {
-    int phase = fifo1.cycle / (2*REG_NWORDS);
+    int phase = c->fifo1.cycle / (2*REG_NWORDS);
     int i;
 
     for (i=0; i<DATA_NREGS; i++) {
         location_t loc = memory_map[remap_memory[phase][i]];
-        fetch_value (reg[i], loc.chip, loc.address - 8);
+        fetch_value (c, reg[i], loc.chip, loc.address - 8);
     }
 }
 
 //
 // Extract program code from the serial shift registers.
 //
-void calc_get_code (unsigned char code[])
+void calc_ctx_get_code (calc_ctx_t *c, unsigned char code[])
 {
     int i;
-    int phase = fifo1.cycle / (2*REG_NWORDS);
+    int phase = c->fifo1.cycle / (2*REG_NWORDS);
     const unsigned char *remap = remap_memory[phase];
 
     for (i=0; i<CODE_NBYTES; i++) {
@@ -282,22 +950,44 @@ void calc_get_code (unsigned char code[])
             loc.address += rem*6 - 42;
 
         // Fetch the opcode.
-        unsigned char *data = chip_base(loc.chip);
+        unsigned char *data = chip_base(c, loc.chip);
         if (! data)                     // Cannot happen
             continue;
-        code[i] = data[loc.address] << 4 | data[loc.address - 3];
+        code[i] = nib_get (data, loc.address) << 4 |
+                  nib_get (data, loc.address - 3);
     }
 }
 
+//
+// Extract the program counter: the address of the next instruction.
+//
+unsigned calc_ctx_get_pc (calc_ctx_t *c)
+{
+    return nib_get (c->ik1302.R, 34) * 10 + nib_get (c->ik1302.R, 31);
+}
+
+//
+// Set the program counter, below CODE_NBYTES: С/П or ПП
+// in automatic mode go on from there.
+//
+void calc_ctx_write_pc (calc_ctx_t *c, unsigned pc)
+{
+    calc_ctx_changed (c);
+    nib_set (c->ik1302.R, 34, pc / 10);
+    nib_set (c->ik1302.R, 31, pc % 10);
+}
+
 //
 // Write program code to the serial shift registers.
 //
-void calc_write_code (unsigned char code[])
+void calc_ctx_write_code (calc_ctx_t *c, unsigned char code[])
 {
     int i;
-    int phase = fifo1.cycle / (2*REG_NWORDS);
+    int phase = c->fifo1.cycle / (2*REG_NWORDS);
     const unsigned char *remap = remap_memory[phase];
 
+    calc_ctx_changed (c);
+
     for (i=0; i<CODE_NBYTES; i++) {
         // Compute the location of the instruction in chip memory.
         location_t loc = memory_map[remap[i / 7]];
@@ -306,15 +996,247 @@ void calc_write_code (unsigned char code[])
             loc.address += rem*6 - 42;
 
         // Fetch the opcode.
-        unsigned char *data = chip_base(loc.chip);
+        unsigned char *data = chip_base(c, loc.chip);
         if (! data)                     // Cannot happen
             continue;
-        data[loc.address] = code[i] >> 4;
-        data[loc.address - 3] = code[i] & 0x0f;
+        nib_set (data, loc.address, code[i] >> 4);
+        nib_set (data, loc.address - 3, code[i] & 0x0f);
     }
 }
 
+//
+// Store stack and register values to the serial shift registers.
+//
+static void store_value (calc_ctx_t *c, const unsigned char value[],
+    unsigned chip, unsigned address)
+{
+    unsigned char *data = chip_base(c, chip);
+    int i;
+
+    if (! data)
+        return;
+    for (i=0; i<6; i++, address-=6) {
+        nib_set (data, address, value[i] & 0x0f);
+        nib_set (data, address - 3, value[i] >> 4);
+    }
+}
+
+//
+// Write stack values to the serial shift registers.
+//
+void calc_ctx_write_stack (calc_ctx_t *c, const unsigned char stack[][6])
+{
+    int phase = c->fifo1.cycle / (2*REG_NWORDS);
+    int i;
+
+    calc_ctx_changed (c);
+    for (i=0; i<5; i++) {
+        location_t loc = stack_map[remap_stack[phase][i]];
+        store_value (c, stack[i], loc.chip, loc.address);
+    }
+}
+
+//
+// Write memory register values to the serial shift registers.
+//
+void calc_ctx_write_regs (calc_ctx_t *c, const unsigned char reg[][6])
+{
+    int phase = c->fifo1.cycle / (2*REG_NWORDS);
+    int i;
+
+    calc_ctx_changed (c);
+    for (i=0; i<DATA_NREGS; i++) {
+        location_t loc = memory_map[remap_memory[phase][i]];
+        store_value (c, reg[i], loc.chip, loc.address - 8);
+    }
+}
+
+//
+// Decode a value of calc_get_stack() format: exponent hundreds,
+// tens, sign of mantissa and units of exponent, then eight
+// mantissa digits, least significant nibble first.
+//
+void calc_value_decode (calc_value_t *v, const unsigned char b[6])
+{
+    uint32_t mant = 0;
+    int exp, i;
+
+    for (i=2; i<6; i++)
+        mant = mant * 100 + (b[i] & 15) * 10 + (b[i] >> 4);
+    exp = (b[0] & 15) * 100 + (b[0] >> 4) * 10 + (b[1] & 15);
+    if (exp >= 500)
+        exp -= 1000;
+    v->mant = mant;
+    v->exp = exp;
+    v->neg = (b[1] >> 4) != 0;
+    v->value = mant * pow (10, exp - 7);
+    if (v->neg)
+        v->value = -v->value;
+}
+
+double calc_value_to_double (const unsigned char value[6])
+{
+    calc_value_t v;
+
+    calc_value_decode (&v, value);
+    return v.value;
+}
+
+void calc_value_encode (const calc_value_t *v, unsigned char b[6])
+{
+    unsigned e = (v->exp + 1000) % 1000;
+    uint32_t mant = v->mant;
+    int i;
+
+    for (i=5; i>=2; i--) {
+        b[i] = (mant % 10) << 4;
+        mant /= 10;
+        b[i] |= mant % 10;
+        mant /= 10;
+    }
+    b[0] = (e / 100) | (e / 10 % 10) << 4;
+    b[1] = (e % 10) | (v->neg ? 0x90 : 0);
+}
+
+//
+// Convert a double to calc_get_stack() format, rounded to eight
+// digits. Values below 1e-99 become zero.
+// Return -1 when the value is too large for the calculator.
+//
+int calc_value_from_double (double x, unsigned char value[6])
+{
+    int neg = x < 0;
+    uint32_t mant = 0;
+    int exp = 0;
+    calc_value_t v;
+
+    if (neg)
+        x = -x;
+    if (! (x < 1e100))
+        return -1;
+    if (x > 0) {
+        // log10() may be off by one near powers of ten
+        exp = (int) floor (log10 (x));
+        mant = (uint32_t) floor (x / pow (10, exp - 7) + 0.5);
+        if (mant < 10000000) {
+            exp--;
+            mant = (uint32_t) floor (x / pow (10, exp - 7) + 0.5);
+        }
+        if (mant >= 100000000) {
+            exp++;
+            mant = (uint32_t) floor (x / pow (10, exp - 7) + 0.5);
+        }
+        if (exp > 99)
+            return -1;
+        if (exp < -99)
+            mant = 0;
+    }
+    if (mant == 0)
+        neg = exp = 0;
+
+    v.mant = mant;
+    v.exp = exp;
+    v.neg = neg;
+    calc_value_encode (&v, value);
+    return 0;
+}
+
+//
+// The machine state was changed other than by stepping:
+// the recorded idle loop and the decoded view are stale.
+//
+void calc_ctx_changed (calc_ctx_t *c)
+{
+    calc_ctx_set_idle (c, c->idle);
+    c->view.stack_cycles = CALC_VIEW_STALE;
+    c->view.reg_cycles = CALC_VIEW_STALE;
+}
+
+//
+// Decoded stack, cached until the machine steps or is changed.
+//
+const calc_value_t *calc_ctx_view_stack (calc_ctx_t *c)
+{
+    calc_view_t *v = &c->view;
+
+    if (v->stack_cycles != c->cycles) {
+        unsigned char stack [5][6];
+        int i;
+
+        calc_ctx_get_stack (c, stack);
+        for (i=0; i<5; i++)
+            calc_value_decode (&v->stack[i], stack[i]);
+        v->stack_cycles = c->cycles;
+    }
+    return v->stack;
+}
+
+//
+// Decoded memory registers, cached the same way.
+//
+const calc_value_t *calc_ctx_view_regs (calc_ctx_t *c)
+{
+    calc_view_t *v = &c->view;
+
+    if (v->reg_cycles != c->cycles) {
+        unsigned char reg [DATA_NREGS][6];
+        int i;
+
+        calc_ctx_get_regs (c, reg);
+        for (i=0; i<DATA_NREGS; i++)
+            calc_value_decode (&v->reg[i], reg[i]);
+        v->reg_cycles = c->cycles;
+    }
+    return v->reg;
+}
+
+//
+// Decoded stacks and/or registers of many contexts at once.
+//
+void calc_ctx_view_many (calc_ctx_t *const c[], unsigned n,
+    calc_value_t stack[][5], calc_value_t reg[][DATA_NREGS])
+{
+    unsigned k;
+
+    for (k=0; k<n; k++) {
+        if (stack)
+            memcpy (stack[k], calc_ctx_view_stack (c[k]), sizeof (stack[k]));
+        if (reg)
+            memcpy (reg[k], calc_ctx_view_regs (c[k]), sizeof (reg[k]));
+    }
+}
+
+void calc_get_stack (unsigned char stack[5][6])
+{
+    calc_ctx_get_stack (&calc, stack);
+}
+
+void calc_get_regs (unsigned char reg[][6])
+{
+    calc_ctx_get_regs (&calc, reg);
+}
+
+void calc_get_code (unsigned char code[])
+{
+    calc_ctx_get_code (&calc, code);
+}
+
+void calc_write_code (unsigned char code[])
+{
+    calc_ctx_write_code (&calc, code);
+}
+
+void calc_write_stack (const unsigned char stack[][6])
+{
+    calc_ctx_write_stack (&calc, stack);
+}
+
+void calc_write_regs (const unsigned char reg[][6])
+{
+    calc_ctx_write_regs (&calc, reg);
+}
+
 plm_t * get_ik1302()
 {
-    return &ik1302;
+    return &calc.ik1302;
 }
\ No newline at end of file
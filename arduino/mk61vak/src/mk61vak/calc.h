@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef MK_54
@@ -39,22 +40,144 @@
 // Specialized PLM chips К145ИК130x.
 //
 #define REG_NWORDS  42                  // Number of words in data register
+#define UCMD_NWORDS 68                  // Number of micro-instructions in ROM
+#define CMD_NWORDS  256                 // Number of instructions in ROM
+
+#ifdef MK_54
+#define PLM_NROMS   2                   // Number of distinct ROM sets
+#else
+#define PLM_NROMS   3
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+//
+// Storage of 4-bit words in the R, M, ST and FIFO registers.
+// With PLM_PACKED two words share a byte, the even one in the low
+// nibble, halving the machine state; else every word takes a byte.
+// Always access them with nib_get() and nib_set().
+//
+#ifdef PLM_PACKED
+#define NIB_BYTES(n)    (((n) + 1) / 2)
+#else
+#define NIB_BYTES(n)    (n)
+#endif
+
+static inline unsigned nib_get (const uint8_t a[], unsigned i)
+{
+#ifdef PLM_PACKED
+    return (a[i >> 1] >> ((i & 1) << 2)) & 0xf;
+#else
+    return a[i];
+#endif
+}
+
+static inline void nib_set (uint8_t a[], unsigned i, unsigned v)
+{
+#ifdef PLM_PACKED
+    unsigned shift = (i & 1) << 2;
+    a[i >> 1] = (a[i >> 1] & ~(0xf << shift)) | (v & 0xf) << shift;
+#else
+    a[i] = v;
+#endif
+}
+
+//
+// Copy n words to or from bytes holding two words each, the even
+// one in the low nibble: the packed layout, whatever the build.
+//
+static inline void nib_pack (uint8_t out[], const uint8_t a[], unsigned n)
+{
+#ifdef PLM_PACKED
+    unsigned i;
+
+    for (i=0; i<NIB_BYTES(n); i++)
+        out[i] = a[i];
+#else
+    unsigned i;
+
+    for (i=0; i<n; i+=2)
+        out[i >> 1] = a[i] | (i+1 < n ? a[i+1] << 4 : 0);
+#endif
+}
+
+static inline void nib_unpack (uint8_t a[], const uint8_t in[], unsigned n)
+{
+    unsigned i;
+
+#ifdef PLM_PACKED
+    for (i=0; i<NIB_BYTES(n); i++)
+        a[i] = in[i];
+#else
+    for (i=0; i<n; i++)
+        a[i] = (in[i >> 1] >> ((i & 1) << 2)) & 0xf;
+#endif
+}
+
+//
+// Pre-decoded micro-instruction.
+// Source fields are masks: 0xf selects the operand, 0 drops it.
+//
+typedef struct {
+    uint8_t alpha_r;                    // alpha |= Ri
+    uint8_t alpha_m;                    // alpha |= Mi
+    uint8_t alpha_st;                   // alpha |= STi
+    uint8_t alpha_nr;                   // alpha |= ~Ri
+    uint8_t alpha_s;                    // alpha |= S
+    uint8_t alpha_c10;                  // alpha |= 10 when carry == 0
+    uint8_t alpha_k;                    // Constant part of alpha
+    uint8_t beta_s;                     // beta |= S
+    uint8_t beta_ns;                    // beta |= ~S
+    uint8_t beta_q;                     // beta |= Q
+    uint8_t beta_k;                     // Constant part of beta
+    uint8_t gamma_c;                    // gamma |= carry (mask 1)
+    uint8_t gamma_nc;                   // gamma |= !carry (mask 1)
+    uint8_t gamma_nkey;                 // gamma |= !keypad_event (mask 1)
+    uint8_t wr;                         // R and S write selectors, PLM_WR_*
+    uint8_t flags;                      // Other side effects, PLM_U_*
+} plm_ucode_t;
+
+#define PLM_WR_R(wr)        ((wr) & 7)          // UCMD_R_* >> 15
+#define PLM_WR_S(wr)        ((wr) >> 3)         // UCMD_S_* >> 22
+
+#define PLM_U_R1_SUM        0x01        // R[i-1] := sum
+#define PLM_U_R2_SUM        0x02        // R[i-2] := sum
+#define PLM_U_M_S           0x04        // Mi := S
+#define PLM_U_CARRY_SUM     0x08        // carry := carry bit of sum
+#define PLM_U_Q_SUM         0x10        // Q := sum
+#define PLM_U_KEYPAD        0x20        // Q := poll_keypad()
+#define PLM_U_ST_SUM        0x40        // ST[i,+1,+2] := sum, STi, ST[i+1]
+#define PLM_U_ST_ROT        0x80        // ST[i,+1,+2] := ST[i+1], ST[i+2], STi
+
+//
+// Decoded tables of one ROM set, shared by all chips running it.
+//
+typedef struct {
+    const uint32_t *inst_rom;           // Key: ROM set this was built from
+    const uint32_t *cmd_rom;
+    const uint8_t *prog_rom;
+    const uint8_t (*useq)[REG_NWORDS];  // Micro-address per instruction and cycle, see useq.h
+    plm_ucode_t ucode [UCMD_NWORDS];    // Pre-decoded inst_rom
+} plm_rom_t;
+
+//
+// Entries of useq[] with this bit set depend on carry:
+// the micro-address is the low bits plus one when carry is clear.
+//
+#define PLM_USEQ_CARRY      0x80
+
 typedef struct {
     uint8_t input;                     // Input word
     uint8_t output;                    // Output word
-    uint8_t R [REG_NWORDS];             // R register
-    uint8_t M [REG_NWORDS];             // M register
-    uint8_t ST [REG_NWORDS];            // ST register
+    uint8_t R [NIB_BYTES(REG_NWORDS)];  // R register
+    uint8_t M [NIB_BYTES(REG_NWORDS)];  // M register
+    uint8_t ST [NIB_BYTES(REG_NWORDS)]; // ST register
     uint8_t S;
     uint8_t Q;
     uint8_t carry;
     uint8_t keypad_event;
-    uint32_t opcode;
     unsigned keyb_x;
     unsigned keyb_y;
     unsigned dot;
@@ -64,23 +187,94 @@ typedef struct {
     const uint32_t *inst_rom;           // Micro-instructions
     const uint32_t *cmd_rom;            // Instructions
     const uint8_t *prog_rom;            // Program
+    const plm_rom_t *rom;               // Decoded ROM tables
+    const uint8_t *useq;                // Micro-addresses of current command
 } plm_t;
 
 //
 // Initialize the PLM data structure.
+// useq_rom[] is the table made by plm_useq_decode() for cmd_rom[].
+// Decodes the ROM set on first use; not thread-safe until then.
 //
 void plm_init (plm_t *t, const uint32_t inst_rom[],
-    const uint32_t cmd_rom[], const uint8_t prog_rom[]);
+    const uint32_t cmd_rom[], const uint8_t prog_rom[],
+    const uint8_t useq_rom[][REG_NWORDS]);
+
+//
+// Resolve the micro-address sequence of one instruction word.
+// Used by tools/useqgen.c to build the tables of useq.h.
+//
+void plm_useq_decode (uint8_t useq[], const uint8_t prog_rom[],
+    uint32_t command);
 
 //
 // Simulate one cycle of the PLM chip.
 //
 void plm_step (plm_t *t, unsigned cycle);
 
+//
+// Simulate all 42 cycles of one word of the PLM chip.
+// in[] is the input for every cycle, out[] receives the output:
+// same as plm_step() for cycles 0...41 with input set each time.
+//
+void plm_step_word (plm_t *t, const uint8_t in[], uint8_t out[]);
+
+
+//
+// Compiled instruction word: runs all 42 cycles of one instruction.
+// in[] is the chip input for every cycle, out[] receives its output.
+// The caller fetches the command and sets input/output afterwards.
+//
+typedef void (*plm_word_t) (plm_t *t, const uint8_t in[], uint8_t out[]);
+
+#ifdef PLM_COMPILED
+//
+// Statically compiled instructions, generated by tools/plmgen.py.
+// Tables are indexed by program counter, like cmd_rom[].
+//
+extern const plm_word_t ik1302_words [CMD_NWORDS];
+extern const plm_word_t ik1303_words [CMD_NWORDS];
+#ifndef MK_54
+extern const plm_word_t ik1306_words [CMD_NWORDS];
+#endif
+#endif
+
+#ifdef PLM_JIT
+//
+// Native code for hot instructions, host x86-64 only (jit.c).
+// While enabled, plm_jit_word() counts each word run and returns
+// native code once the instruction is hot, or 0 to interpret it.
+// Not thread-safe.
+//
+void plm_jit_enable (int on);
+int plm_jit_enabled (void);
+plm_word_t plm_jit_word (const plm_rom_t *rom, unsigned pc);
+
+//
+// Drop all code compiled for a ROM set.
+// Called by plm_init() when a decoded ROM slot is rebuilt.
+//
+void plm_jit_flush (const plm_rom_t *rom);
+
+//
+// Number of instructions compiled so far and their total code size.
+//
+void plm_jit_stats (unsigned *words, size_t *bytes);
+#endif
 
 plm_t * get_ik1302();
 uint32_t plm_get_cmd_rom(plm_t *t, uint16_t pc);
 
+//
+// Save the state of a PLM chip into PLM_STATE_SIZE bytes,
+// without the ROM pointers, and load it back into a chip
+// initialized with the same ROM set.
+//
+#define PLM_STATE_SIZE  (3*REG_NWORDS/2 + 16)
+
+void plm_save (const plm_t *t, uint8_t buf[]);
+void plm_load (plm_t *t, const uint8_t buf[]);
+
 //
 // FIFO serial memory chip К145ИР2.
 //
@@ -90,7 +284,7 @@ typedef struct {
     uint8_t input;                     // Input word
     uint8_t output;                    // Output word
     uint16_t cycle;                     // Cycle counter
-    uint8_t data [FIFO_NWORDS];   // FIFO memory
+    uint8_t data [NIB_BYTES(FIFO_NWORDS)]; // FIFO memory
 } fifo_t;
 
 //
@@ -104,9 +298,278 @@ void fifo_init (fifo_t *t);
 void fifo_step (fifo_t *t);
 
 //
-// Initialize the calculator.
+// Save the state of a FIFO chip into FIFO_STATE_SIZE bytes
+// and load it back. fifo_load() returns -1 and leaves the chip
+// unchanged when the saved cycle is not at a word boundary.
+//
+#define FIFO_STATE_SIZE (FIFO_NWORDS/2 + 4)
+
+void fifo_save (const fifo_t *t, uint8_t buf[]);
+int fifo_load (fifo_t *t, const uint8_t buf[]);
+
+//
+// Calculator context: the whole chip ring plus user callbacks.
+// Any number of contexts may run independently.
+//
+typedef struct calc_ctx calc_ctx_t;
+typedef struct calc_idle calc_idle_t;
+
+//
+// One whole display frame, see calc_ctx_set_frame().
+// Positions are numbered as i of the display callback.
+//
+typedef struct {
+    int8_t digit [12];                  // 0...15, or -1 when dark
+    int8_t dot [12];                    // 1 when lit, 0 or -1 when dark
+    uint8_t blink;                      // Run mode: the display blinks, digits dark
+} calc_frame_t;
+
+//
+// Queue of timed key events, see calc_ctx_press().
+//
+#define CALC_KEYQ_SIZE  32              // Events queued at most
+
+typedef struct {
+    uint8_t key [CALC_KEYQ_SIZE];       // Keycode, or 0 to release
+    uint32_t hold [CALC_KEYQ_SIZE];     // Words left to play it
+    unsigned head;                      // Event being played
+    unsigned count;                     // Events queued
+    unsigned settle;                    // Automatic hold: words ready
+} calc_keyq_t;
+
+//
+// Decoded stack or register value, see calc_ctx_view_stack().
+//
+typedef struct {
+    uint32_t mant;                      // Eight mantissa digits as stored
+    int16_t exp;                        // Decimal exponent of the first digit
+    uint8_t neg;                        // Negative mantissa
+    double value;                       // The same as a double
+} calc_value_t;
+
+#define CALC_VIEW_STALE (~(uint64_t) 0) // Not decoded since the last change
+
+typedef struct {
+    calc_value_t stack [5];             // X1, X, Y, Z, T
+    calc_value_t reg [DATA_NREGS];
+    uint64_t stack_cycles;              // Cycle count when decoded
+    uint64_t reg_cycles;
+} calc_view_t;
+
+struct calc_ctx {
+    plm_t ik1302;                       // MK-54 has two PLM chips
+    plm_t ik1303;
+#ifndef MK_54
+    plm_t ik1306;                       // MK-61 has a third one
+#endif
+    fifo_t fifo1;                       // and two serial FIFOs
+    fifo_t fifo2;
+
+    int (*keypad) (calc_ctx_t *c);      // Poll the keypad
+    int (*rgd) (calc_ctx_t *c);         // Poll the radians/grads/degrees switch
+    void (*display) (calc_ctx_t *c, int i, int digit, int dot);
+    void (*poll) (calc_ctx_t *c);       // Called at the poll cadence
+    void (*run) (calc_ctx_t *c, int on); // Turbo: program started or stopped
+    void (*frame) (calc_ctx_t *c, const calc_frame_t *f); // Changed frame, or 0
+    void *user;                         // Free for the caller
+    calc_idle_t *idle;                  // Idle fast-forward, or 0
+    uint64_t cycles;                    // Emulated cycles since init
+    uint8_t turbo;                      // No display while running
+    uint8_t running;                    // Turbo: run(c, 1) was called last
+    uint8_t poll_cadence;               // CALC_POLL_*
+    uint8_t input;                      // Keys queued, rgd fixed: no polling
+    int rgd_mode;                       // Switch position when input is set
+    calc_keyq_t keyq;                   // Key events when input is set
+    calc_frame_t frame_next;            // Frame being scanned
+    calc_frame_t frame_shown;           // Frame passed to frame() last
+    calc_view_t view;                   // Decoded stack and registers
+};
+
+//
+// Idle fast-forward.
+// While stopped with no key pressed, the machine loops through
+// the same states. After CALC_IDLE_STEPS quiet steps that return
+// the machine exactly to where they started, calc_ctx_step() replays
+// the recorded display instead of simulating, until keypad or rgd
+// report a change. Callbacks see the same calls either way.
+//
+#define CALC_IDLE_STEPS 3               // FIFO phase repeats every 3 steps
+
+struct calc_idle {
+    calc_ctx_t state [CALC_IDLE_STEPS]; // Machine at the start of each step
+    uint8_t display [CALC_IDLE_STEPS][560]; // Display symbols of each step
+    int rgd;                            // Switch position while recorded
+    unsigned count;                     // Quiet steps recorded in a row
+    unsigned phase;                     // Step replayed next
+    int replay;                         // Fast-forwarding
+};
+
+//
+// Enable idle fast-forward using the given tracker, or disable with 0.
+//
+void calc_ctx_set_idle (calc_ctx_t *c, calc_idle_t *idle);
+
+//
+// Return 1 when the last step was replayed: the machine waits for input
+// and the caller may sleep between steps.
+//
+int calc_ctx_idle (calc_ctx_t *c);
+
+//
+// Frame-level display.
+// With a frame callback set, the display callback is no longer
+// called. Instead, every 14 words, when the scan of all 12 positions
+// is complete, the frame is passed to the callback, only when it
+// differs from the one passed before. Running a program gives one
+// dark frame with blink set. Set 0 to go back to the display callback.
+//
+void calc_ctx_set_frame (calc_ctx_t *c,
+    void (*frame) (calc_ctx_t *c, const calc_frame_t *f));
+
+//
+// Turbo run mode.
+// While a user program runs, the display callback is not called;
+// instead run(c, 1) is called once when the program starts and
+// run(c, 0) when it stops, followed by the usual display.
+// The machine itself runs exactly as without turbo.
+//
+void calc_ctx_set_turbo (calc_ctx_t *c, int on);
+
+//
+// How often the poll callback is called: before every word
+// (the default), before every step, or never.
+// With -DCALC_NO_POLL the hook is compiled out altogether:
+// the cadence is ignored and calc_poll() need not be defined.
+//
+#define CALC_POLL_NEVER 0
+#define CALC_POLL_STEP  1
+#define CALC_POLL_WORD  2
+
+void calc_ctx_set_poll (calc_ctx_t *c, int cadence);
+
+//
+// Queued input.
+// The first call of calc_ctx_press() or calc_ctx_set_rgd() switches
+// the context from the keypad and rgd callbacks to a queue of key
+// events and a fixed switch position, read every word without calls.
+// Each event holds the key for hold_words words, back to back with
+// the next one; key 0 releases the keypad for that long. The machine
+// needs the key released for a while before it notices the next one.
+// With hold_words = CALC_HOLD_AUTO the key is held only until the
+// keyboard scan of ИК1302 latched it, then released until the ROM
+// is back in its display loop for CALC_KEY_SETTLE words: as fast
+// as the ROM accepts keys, however long each one takes.
+// Return -1 when the queue is full, else 0.
+//
+#define CALC_HOLD_AUTO  (~0u)           // Hold until latched, then settle
+#ifndef CALC_KEY_SETTLE
+#define CALC_KEY_SETTLE 14              // Words released after a latched key
+#endif
+
+int calc_ctx_press (calc_ctx_t *c, int key, unsigned hold_words);
+void calc_ctx_set_rgd (calc_ctx_t *c, int mode);
+
+//
+// Number of key events not yet played through.
+//
+unsigned calc_ctx_keys_queued (calc_ctx_t *c);
+
+//
+// Number of chip cycles simulated since calc_ctx_init(),
+// 42 per word, 23520 per step; replayed idle steps count too.
+//
+uint64_t calc_ctx_cycles (calc_ctx_t *c);
+
+//
+// Initialize the calculator context.
+// Callbacks are set to no-ops: no key pressed, radians mode,
+// display ignored. Override them after this call.
+//
+void calc_ctx_init (calc_ctx_t *c);
+
+//
+// Initialize the calculator context already powered up, with 0.
+// on the display and ready for keys, from a snapshot built in.
+// Same as calc_ctx_init() followed by the first few calc_ctx_step().
+//
+void calc_ctx_init_fast (calc_ctx_t *c);
+
+//
+// Simulate one cycle of the calculator context.
+// Return 0 when stopped, or 1 when running a user program.
+//
+int calc_ctx_step (calc_ctx_t *c);
+
+//
+// Snapshot of the machine: the chips and FIFOs as a versioned blob
+// of CALC_SAVE_SIZE bytes, the same with or without PLM_PACKED.
+// Callbacks, the idle tracker and the input queue are not saved.
+// calc_ctx_save_state() returns the size written; calc_ctx_load_state()
+// returns -1 when the blob is of another size, version or model,
+// or its FIFOs are not at the same word boundary, else 0.
+// The context is left unchanged on error.
+//
+#define CALC_SAVE_VERSION   1
+#define CALC_SAVE_SIZE      (4 + PLM_NROMS*PLM_STATE_SIZE + 2*FIFO_STATE_SIZE)
+
+size_t calc_ctx_save_state (calc_ctx_t *c, uint8_t buf[]);
+int calc_ctx_load_state (calc_ctx_t *c, const uint8_t buf[], size_t size);
+
+//
+// Stack, register and program access for a context.
+// See calc_get_stack() and friends below.
+//
+void calc_ctx_get_stack (calc_ctx_t *c, unsigned char stack[][6]);
+void calc_ctx_get_regs (calc_ctx_t *c, unsigned char reg[][6]);
+void calc_ctx_get_code (calc_ctx_t *c, unsigned char code[]);
+void calc_ctx_write_code (calc_ctx_t *c, unsigned char code[]);
+void calc_ctx_write_stack (calc_ctx_t *c, const unsigned char stack[][6]);
+void calc_ctx_write_regs (calc_ctx_t *c, const unsigned char reg[][6]);
+void calc_ctx_write_pc (calc_ctx_t *c, unsigned pc);
+
+//
+// Decoded view of the stack (X1, X, Y, Z, T) and the memory registers.
+// Values are decoded on the first call after the machine steps and
+// cached until the next step; polling X costs a compare in between.
+// calc_ctx_view_many() fills stack[n][5] and/or reg[n][DATA_NREGS]
+// for n contexts; pass 0 for the part not wanted.
+//
+const calc_value_t *calc_ctx_view_stack (calc_ctx_t *c);
+const calc_value_t *calc_ctx_view_regs (calc_ctx_t *c);
+void calc_ctx_view_many (calc_ctx_t *const c[], unsigned n,
+    calc_value_t stack[][5], calc_value_t reg[][DATA_NREGS]);
+
+//
+// Call after changing the chips or FIFOs of a context directly:
+// drops the recorded idle loop and the decoded view.
+// The write and load functions here do it themselves.
+//
+void calc_ctx_changed (calc_ctx_t *c);
+unsigned calc_ctx_get_pc (calc_ctx_t *c);
+
+//
+// The calculator below is a single global context
+// driven by the calc_keypad(), calc_rgd(), calc_display()
+// and calc_poll() user functions.
+//
+calc_ctx_t *calc_get_ctx (void);
+void calc_set_idle (calc_idle_t *idle);
+int calc_idle (void);
+void calc_set_turbo (int on);
+void calc_set_poll (int cadence);
+size_t calc_save_state (uint8_t buf[]);
+int calc_load_state (const uint8_t buf[], size_t size);
+uint64_t calc_cycles (void);
+int calc_press (int key, unsigned hold_words);
+void calc_set_rgd (int mode);
+unsigned calc_keys_queued (void);
+
+//
+// Initialize the calculator; calc_init_fast() starts it
+// powered up, see calc_ctx_init_fast().
 //
 void calc_init (void);
+void calc_init_fast (void);
 
 //
 // Simulate one cycle of the calculator.
@@ -121,6 +584,12 @@ int calc_step (void);
 //
 extern void calc_display (int i, int digit, int dot);
 
+//
+// User function: in turbo mode, a program started (on = 1)
+// or stopped (on = 0).
+//
+extern void calc_running (int on);
+
 //
 // User function: poll the radians/grads/degrees switch.
 //
@@ -169,6 +638,7 @@ extern int calc_keypad(void);
 
 //
 // Poll the USB port.
+// Called at the poll cadence, see calc_ctx_set_poll().
 //
 void calc_poll(void);
 
@@ -194,6 +664,30 @@ void calc_get_code (unsigned char code[]);
 //
 void calc_write_code (unsigned char code[]);
 
+//
+// Update the stack or the memory registers, in the format of
+// calc_get_stack() and calc_get_regs(). The display shows the
+// new X after the next key. Write while stopped, not in the
+// middle of typing a number.
+//
+void calc_write_stack (const unsigned char stack[][6]);
+void calc_write_regs (const unsigned char reg[][6]);
+
+//
+// Convert between doubles and the twelve-digit values above.
+// calc_value_from_double() rounds to eight digits and returns -1
+// when the magnitude is 1e100 or more; smaller than 1e-99 is zero.
+//
+double calc_value_to_double (const unsigned char value[6]);
+int calc_value_from_double (double x, unsigned char value[6]);
+
+//
+// Split a twelve-digit value into mantissa, exponent and sign,
+// and put it back together. calc_value_encode() ignores v->value.
+//
+void calc_value_decode (calc_value_t *v, const unsigned char value[6]);
+void calc_value_encode (const calc_value_t *v, unsigned char value[6]);
+
 //
 // Microinstructions
 //
@@ -0,0 +1,801 @@
+/*
+ * High-level emulation of MK-61 user programs.
+ *
+ * Opcodes: 00-0F number entry and stack, 10-3B arithmetic except
+ * the functions 15-1E and 24, 4N store, 50-5E control, 6N recall, 7N-EN the same
+ * through register N. Numbers have eight decimal digits and
+ * an exponent -99...99; the adder rounds the digits shifted out
+ * of the smaller operand one by one, like the ROM does.
+ */
+#include <math.h>
+#include <string.h>
+#include "hle.h"
+
+enum { SX1, SX, SY, SZ, ST };
+
+static const uint32_t pow10_tab [10] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000,
+    10000000, 100000000, 1000000000,
+};
+
+#define MANT_MIN    10000000u
+#define MANT_LIMIT  100000000u
+
+static const hle_num_t num_zero = { 0, 0, 0 };
+
+//
+// Value of calc_get_stack() format, with the mantissa normalized.
+//
+static hle_num_t num_decode (const unsigned char b[6])
+{
+    calc_value_t v;
+    hle_num_t n;
+
+    calc_value_decode (&v, b);
+    if (v.mant == 0)
+        return num_zero;
+    n.mant = v.mant;
+    n.exp = v.exp;
+    n.neg = v.neg;
+    while (n.mant < MANT_MIN) {
+        n.mant *= 10;
+        n.exp--;
+    }
+    return n;
+}
+
+static void num_encode (hle_num_t n, unsigned char b[6])
+{
+    calc_value_t v;
+
+    v.mant = n.mant;
+    v.exp = n.exp;
+    v.neg = n.neg;
+    calc_value_encode (&v, b);
+}
+
+//
+// Build the number m * 10^(exp-7) from a mantissa of any length,
+// truncating it to eight digits.
+// Return 0 on overflow; underflow gives zero.
+//
+static int num_make (hle_num_t *r, uint64_t m, int exp, int neg)
+{
+    if (m == 0) {
+        *r = num_zero;
+        return 1;
+    }
+    while (m >= MANT_LIMIT) {
+        m /= 10;
+        exp++;
+    }
+    while (m < MANT_MIN) {
+        m *= 10;
+        exp--;
+    }
+    if (exp > 99)
+        return 0;
+    if (exp < -99) {
+        *r = num_zero;
+        return 1;
+    }
+    r->mant = m;
+    r->exp = exp;
+    r->neg = neg;
+    return 1;
+}
+
+//
+// Compare magnitudes.
+//
+static int num_cmp_abs (hle_num_t a, hle_num_t b)
+{
+    if (a.mant == 0 || b.mant == 0)
+        return (a.mant != 0) - (b.mant != 0);
+    if (a.exp != b.exp)
+        return a.exp < b.exp ? -1 : 1;
+    return (a.mant > b.mant) - (a.mant < b.mant);
+}
+
+//
+// Round half up to the next digit: toward plus infinity,
+// the way the ROM rounds in ten's complement.
+//
+static int64_t round_digit (int64_t s)
+{
+    s += 5;
+    return (s >= 0) ? s / 10 : -((9 - s) / 10);
+}
+
+//
+// Sum: the smaller operand is aligned with all its digits,
+// then rounded one digit at a time up to the last digit of
+// the larger one. A carry out of the eight digits rounds
+// the magnitude once more, half up.
+//
+static int num_add (hle_num_t *r, hle_num_t a, hle_num_t b)
+{
+    int64_t s, y;
+    int d, exp, i;
+
+    if (num_cmp_abs (a, b) < 0) {
+        hle_num_t t = a;
+        a = b;
+        b = t;
+    }
+    if (b.mant == 0) {
+        *r = a;
+        return 1;
+    }
+    d = a.exp - b.exp;
+    s = (int64_t) a.mant * MANT_LIMIT;
+    if (a.neg)
+        s = -s;
+    if (d <= 8) {
+        // Further digits never round up to the last digit of a
+        y = (int64_t) b.mant * pow10_tab[8 - d];
+        s += b.neg ? -y : y;
+    }
+    for (i=0; i<8; i++)
+        s = round_digit (s);
+
+    exp = a.exp;
+    if (s >= (int64_t) MANT_LIMIT || s <= -(int64_t) MANT_LIMIT) {
+        s = (s < 0) ? -((5 - s) / 10) : (s + 5) / 10;
+        exp++;
+    }
+    return num_make (r, (s < 0) ? -s : s, exp, s < 0);
+}
+
+//
+// Product: the ROM keeps nine digits of a product of mantissas
+// of ten or more, and rounds them to eight; a smaller one
+// is truncated.
+//
+static int num_mul (hle_num_t *r, hle_num_t a, hle_num_t b)
+{
+    uint64_t m = (uint64_t) a.mant * b.mant;
+
+    if (m == 0) {
+        *r = num_zero;
+        return 1;
+    }
+    if (m >= (uint64_t) MANT_LIMIT * MANT_LIMIT / 10)
+        return num_make (r, (m / MANT_MIN + 5) / 10, a.exp + b.exp + 1,
+            a.neg ^ b.neg);
+    return num_make (r, m, a.exp + b.exp - 7, a.neg ^ b.neg);
+}
+
+//
+// Quotient is truncated.
+//
+static int num_div (hle_num_t *r, hle_num_t a, hle_num_t b)
+{
+    uint64_t q;
+
+    if (b.mant == 0)
+        return 0;
+    if (a.mant == 0) {
+        *r = num_zero;
+        return 1;
+    }
+    q = (uint64_t) a.mant * MANT_LIMIT / b.mant;
+    return num_make (r, q, a.exp - b.exp - 1, a.neg ^ b.neg);
+}
+
+//
+// Square root, truncated.
+//
+static int num_sqrt (hle_num_t *r, hle_num_t a)
+{
+    uint64_t n, q;
+    int exp;
+
+    if (a.mant == 0) {
+        *r = num_zero;
+        return 1;
+    }
+    if (a.neg)
+        return 0;
+
+    // Scale to 15...17 digits, leaving an even power of ten.
+    exp = a.exp - 7;
+    if (exp & 1) {
+        n = (uint64_t) a.mant * 1000000000;
+        exp -= 9;
+    } else {
+        n = (uint64_t) a.mant * 100000000;
+        exp -= 8;
+    }
+    q = (uint64_t) sqrt ((double) n);
+    while (q * q > n)
+        q--;
+    while ((q + 1) * (q + 1) <= n)
+        q++;
+
+    // Value is q * 10^(exp/2).
+    return num_make (r, q, exp/2 + 7, 0);
+}
+
+//
+// Integer part, truncated toward zero.
+//
+static hle_num_t num_trunc (hle_num_t a)
+{
+    if (a.mant == 0 || a.exp < 0)
+        return num_zero;
+    if (a.exp < 7)
+        a.mant -= a.mant % pow10_tab[7 - a.exp];
+    return a;
+}
+
+//
+// Stack manipulation.
+//
+static void push (calc_hle_t *h, hle_num_t v)
+{
+    h->stack[ST] = h->stack[SZ];
+    h->stack[SZ] = h->stack[SY];
+    h->stack[SY] = h->stack[SX];
+    h->stack[SX] = v;
+}
+
+static void drop (calc_hle_t *h, hle_num_t v)
+{
+    h->stack[SX1] = h->stack[SX];
+    h->stack[SX] = v;
+    h->stack[SY] = h->stack[SZ];
+    h->stack[SZ] = h->stack[ST];
+}
+
+//
+// Value of the number being typed.
+//
+static hle_num_t entry_value (calc_hle_t *h)
+{
+    hle_num_t v;
+    int exp = h->eneg ? -h->edigits : h->edigits;
+    int point = (h->point == HLE_NO_POINT) ? h->ndigits : h->point;
+
+    if (! num_make (&v, h->digits, exp + point - h->ndigits + 7, h->mneg))
+        v = num_zero;
+    return v;
+}
+
+//
+// Opcodes 00-0C: digits, point, sign and exponent.
+//
+static void entry_key (calc_hle_t *h, unsigned op)
+{
+    hle_num_t x = h->stack[SX];
+
+    if (! h->entry) {
+        switch (op) {
+        case 0x0a:
+            // A point alone does nothing.
+            return;
+        case 0x0b:
+            // /-/ of a result, zero keeps the sign.
+            h->stack[SX].neg ^= 1;
+            return;
+        case 0x0c:
+            // ВП of a result: exponent for it, or for 1.
+            h->digits = x.mant ? x.mant : 1;
+            h->ndigits = x.mant ? 8 : 1;
+            h->point = x.mant ? x.exp + 1 : 1;
+            h->mneg = x.neg;
+            break;
+        default:
+            if (h->lift)
+                push (h, num_zero);
+            h->digits = 0;
+            h->ndigits = 0;
+            h->point = HLE_NO_POINT;
+            h->mneg = 0;
+            break;
+        }
+        h->entry = 1;
+        h->eneg = 0;
+        h->edigits = 0;
+    }
+    if (op < 10) {
+        if (h->entry == 2) {
+            h->edigits = (h->edigits * 10 + op) % 100;
+        } else if (h->ndigits < 8) {
+            h->digits = h->digits * 10 + op;
+            h->ndigits++;
+        }
+    } else if (op == 0x0a) {
+        // Point of the mantissa, or back to it from the exponent.
+        if (h->entry == 2) {
+            h->entry = 1;
+        } else if (h->point == HLE_NO_POINT) {
+            if (h->ndigits == 0)
+                h->ndigits = 1;
+            h->point = h->ndigits;
+        }
+    } else if (op == 0x0b) {
+        if (h->entry == 2) {
+            h->eneg ^= 1;
+        } else {
+            // Sign of the mantissa ends it; the next digit
+            // starts a new number in place of it.
+            h->mneg ^= 1;
+            h->stack[SX] = entry_value (h);
+            h->entry = 0;
+            h->lift = 0;
+            return;
+        }
+    } else {
+        // Exponent of 1 when no digits are typed.
+        if (h->digits == 0) {
+            h->digits = 1;
+            h->ndigits = 1;
+            h->point = HLE_NO_POINT;
+        }
+        h->entry = 2;
+    }
+    h->stack[SX] = entry_value (h);
+    h->lift = 1;
+}
+
+//
+// Address byte of a jump: two decimal digits, A0-A4 above 99.
+//
+static int jump_target (calc_hle_t *h, unsigned pos)
+{
+    unsigned a = (pos < CODE_NBYTES) ? h->code [pos] : 0xff;
+    unsigned addr = (a >> 4) * 10 + (a & 15);
+
+    return (addr < CODE_NBYTES) ? (int) addr : -1;
+}
+
+//
+// Integer part of a non-negative number below 10^8.
+//
+static uint32_t num_uint (hle_num_t a)
+{
+    if (a.mant == 0 || a.exp < 0)
+        return 0;
+    return a.mant / pow10_tab[7 - a.exp];
+}
+
+//
+// Address or register number of an indirect instruction through
+// register n: the last two digits of its integer part, below limit.
+// The fraction is dropped, and R0-R3 are decremented and R4-R6
+// incremented before use: the new value is stored into *mod.
+// Return -1 for values the ROM treats in other ways:
+// negative, 10^8 and above, below 1 except 0 in R4-RE.
+//
+static int indirect (calc_hle_t *h, unsigned n, unsigned limit, hle_num_t *mod)
+{
+    hle_num_t v = h->reg[n];
+    uint32_t i = num_uint (v);
+
+    if (v.neg || v.exp > 7 || ((v.mant != 0) ? v.exp < 0 : n <= 3))
+        return -1;
+    if (n <= 3)
+        i--;
+    else if (n <= 6)
+        i++;
+    num_make (mod, i, 7, 0);
+    i %= 100;
+    return (i < limit) ? (int) i : -1;
+}
+
+//
+// Conditions of opcodes 57, 59, 5C, 5E and 7N, 9N, CN, EN.
+//
+static int condition (calc_hle_t *h, unsigned kind)
+{
+    hle_num_t x = h->stack[SX];
+
+    switch (kind) {
+    case 0x7: return x.mant != 0;
+    case 0x9: return x.mant == 0 || ! x.neg;
+    case 0xc: return x.mant != 0 && x.neg;
+    default:  return x.mant == 0;
+    }
+}
+
+//
+// Return stack of five addresses, shifted in with zeros.
+// Each entry is the address before the one to return to.
+//
+static void call (calc_hle_t *h, unsigned link, unsigned target)
+{
+    memmove (h->ret + 1, h->ret, sizeof h->ret - 1);
+    h->ret[0] = link;
+    h->pc = target;
+}
+
+static void ret (calc_hle_t *h)
+{
+    h->pc = (h->ret[0] + 1);
+    memmove (h->ret, h->ret + 1, sizeof h->ret - 1);
+    h->ret[sizeof h->ret - 1] = 0;
+}
+
+int calc_hle_step (calc_hle_t *h)
+{
+    unsigned pc = h->pc;
+    unsigned op, n;
+    unsigned entry = h->entry;
+    hle_num_t x = h->stack[SX];
+    hle_num_t v;
+    int target = 0, ok = 1;
+
+    // Past the end, the calculator reaches hidden addresses.
+    if (pc >= CODE_NBYTES)
+        return CALC_HLE_UNSUPPORTED;
+    op = h->code [pc];
+    n = op & 15;
+
+    if (op <= 0x0c) {
+        entry_key (h, op);
+        h->pc = (pc + 1);
+        return CALC_HLE_RUN;
+    }
+
+    // Any other opcode ends number entry.
+    if (op >= 0x51 && op <= 0x5e && op != 0x52 && op != 0x54 &&
+        op != 0x55 && op != 0x56) {
+        target = jump_target (h, pc + 1);
+        if (target < 0)
+            goto unsupported;
+    }
+    h->entry = 0;
+    h->pc = (pc + 1);
+
+    switch (op) {
+    case 0x0d:                          // Cx
+        h->stack[SX] = num_zero;
+        if (entry)
+            h->lift = 0;
+        return CALC_HLE_RUN;
+    case 0x0e:                          // B↑
+        push (h, x);
+        h->lift = 0;
+        return CALC_HLE_RUN;
+    case 0x0f:                          // Bx
+        push (h, h->stack[SX1]);
+        break;
+    case 0x10:                          // +
+        ok = num_add (&v, h->stack[SY], x);
+        if (ok)
+            drop (h, v);
+        break;
+    case 0x11:                          // -
+        x.neg ^= (x.mant != 0);
+        ok = num_add (&v, h->stack[SY], x);
+        if (ok)
+            drop (h, v);
+        break;
+    case 0x12:                          // ×
+        ok = num_mul (&v, h->stack[SY], x);
+        if (ok)
+            drop (h, v);
+        break;
+    case 0x13:                          // ÷
+        ok = num_div (&v, h->stack[SY], x);
+        if (ok)
+            drop (h, v);
+        break;
+    case 0x14:                          // ↔
+        h->stack[SX1] = x;
+        h->stack[SX] = h->stack[SY];
+        h->stack[SY] = x;
+        break;
+    case 0x15: case 0x16: case 0x17: case 0x18: case 0x19:
+    case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e:
+    case 0x24:
+        // Functions of X: the ROM series are not reproduced,
+        // a double differs in the last digit.
+        goto unsupported;
+    case 0x20:                          // π
+        h->stack[SX1] = x;
+        v.mant = 31415926;
+        v.exp = 0;
+        v.neg = 0;
+        push (h, v);
+        break;
+    case 0x21:                          // √
+        ok = num_sqrt (&v, x);
+        if (ok) {
+            h->stack[SX1] = x;
+            h->stack[SX] = v;
+        }
+        break;
+    case 0x22:                          // x²
+        ok = num_mul (&v, x, x);
+        if (ok) {
+            h->stack[SX1] = x;
+            h->stack[SX] = v;
+        }
+        break;
+    case 0x23:                          // 1/x
+        v.mant = MANT_MIN;
+        v.exp = 0;
+        v.neg = 0;
+        ok = num_div (&v, v, x);
+        if (ok) {
+            h->stack[SX1] = x;
+            h->stack[SX] = v;
+        }
+        break;
+    case 0x25:                          // ⟳
+        h->stack[SX1] = x;
+        h->stack[SX] = h->stack[SY];
+        h->stack[SY] = h->stack[SZ];
+        h->stack[SZ] = h->stack[ST];
+        h->stack[ST] = x;
+        break;
+    case 0x31:                          // K |x|
+        h->stack[SX1] = x;
+        h->stack[SX].neg = 0;
+        break;
+    case 0x32:                          // K ЗН
+        h->stack[SX1] = x;
+        if (x.mant != 0) {
+            v.mant = MANT_MIN;
+            v.exp = 0;
+            v.neg = x.neg;
+            h->stack[SX] = v;
+        }
+        break;
+    case 0x34:                          // K [x]
+        h->stack[SX1] = x;
+        h->stack[SX] = num_trunc (x);
+        break;
+    case 0x35:                          // K {x}
+        h->stack[SX1] = x;
+        v = num_trunc (x);
+        v.neg ^= (v.mant != 0);
+        num_add (&h->stack[SX], x, v);
+        break;
+    case 0x40: case 0x41: case 0x42: case 0x43: case 0x44:
+    case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+    case 0x4a: case 0x4b: case 0x4c: case 0x4d: case 0x4e:
+        if (x.mant == 0)                // П N, also drops -0
+            h->stack[SX] = x = num_zero;
+        h->reg[n] = x;
+        break;
+    case 0x50:                          // С/П
+        h->lift = 1;
+        return CALC_HLE_STOP;
+    case 0x51:                          // БП
+        h->pc = target;
+        break;
+    case 0x52:                          // В/О
+        ret (h);
+        break;
+    case 0x53:                          // ПП
+        call (h, pc + 1, target);
+        break;
+    case 0x54:                          // К НОП
+        break;
+    case 0x57: case 0x59: case 0x5c: case 0x5e:
+        h->pc = condition (h, (op == 0x57) ? 7 : (op == 0x59) ? 9 :
+            (op == 0x5c) ? 0xc : 0xe) ? (int) pc + 2 : target;
+        break;
+    case 0x58: case 0x5a: case 0x5b: case 0x5d:
+        // Loops L2, L3, L1, L0.
+        // The register counts its integer part down, dropping
+        // the fraction; the loop ends at 1, leaving it as is.
+        // Below 1 the last mantissa digit counts, and 0 wraps
+        // around to -99999999.
+        n = (op == 0x5d) ? 0 : (op == 0x5b) ? 1 : (op == 0x58) ? 2 : 3;
+        v = h->reg[n];
+        if (v.neg || v.exp > 7)
+            goto unsupported;
+        if (v.mant == 0) {
+            num_make (&h->reg[n], MANT_LIMIT - 1, 7, 1);
+        } else if (v.exp < 0) {
+            num_make (&h->reg[n], v.mant - 1, v.exp, 0);
+        } else if (num_uint (v) == 1) {
+            h->pc = pc + 2;
+            break;
+        } else {
+            num_make (&h->reg[n], num_uint (v) - 1, 7, 0);
+        }
+        h->pc = target;
+        break;
+    case 0x60: case 0x61: case 0x62: case 0x63: case 0x64:
+    case 0x65: case 0x66: case 0x67: case 0x68: case 0x69:
+    case 0x6a: case 0x6b: case 0x6c: case 0x6d: case 0x6e:
+        push (h, h->reg[n]);            // ИП N
+        break;
+    default:
+        if (op < 0x70 || op > 0xee || n >= DATA_NREGS)
+            goto unsupported;
+        switch (op >> 4) {
+        case 0x7: case 0x9: case 0xc: case 0xe:
+            // Conditions with the address in a register.
+            if (condition (h, op >> 4))
+                break;
+            /* fall through */
+        case 0x8: case 0xa:
+            // К БП, К ПП.
+            target = indirect (h, n, CODE_NBYTES, &v);
+            if (target < 0)
+                goto unsupported;
+            h->reg[n] = v;
+            if ((op >> 4) == 0xa)
+                call (h, pc, target);
+            else
+                h->pc = target;
+            break;
+        default:
+            // К П, К ИП.
+            target = indirect (h, n, DATA_NREGS, &v);
+            if (target < 0)
+                goto unsupported;
+            h->reg[n] = v;
+            if ((op >> 4) == 0xb)
+                h->reg[target] = x;
+            else
+                push (h, h->reg[target]);
+            break;
+        }
+        break;
+    }
+    h->lift = 1;
+    return ok ? CALC_HLE_RUN : CALC_HLE_ERROR;
+
+unsupported:
+    h->pc = pc;
+    h->entry = entry;
+    return CALC_HLE_UNSUPPORTED;
+}
+
+int calc_hle_run (calc_hle_t *h, unsigned long max_insns, unsigned long *count)
+{
+    unsigned long i;
+    int status = CALC_HLE_RUN;
+
+    for (i=0; i<max_insns && status == CALC_HLE_RUN; ) {
+        status = calc_hle_step (h);
+        if (status != CALC_HLE_UNSUPPORTED)
+            i++;
+    }
+    if (count)
+        *count = i;
+    return status;
+}
+
+void calc_hle_load (calc_hle_t *h, calc_ctx_t *c)
+{
+    unsigned char stack [5][6], reg [DATA_NREGS][6];
+    int i;
+
+    memset (h, 0, sizeof *h);
+    calc_ctx_get_code (c, h->code);
+    calc_ctx_get_stack (c, stack);
+    calc_ctx_get_regs (c, reg);
+    for (i=0; i<5; i++)
+        h->stack[i] = num_decode (stack[i]);
+    for (i=0; i<DATA_NREGS; i++)
+        h->reg[i] = num_decode (reg[i]);
+    h->pc = calc_ctx_get_pc (c);
+    h->rgd = c->input ? c->rgd_mode : c->rgd (c);
+    h->lift = 1;
+}
+
+void calc_hle_store (const calc_hle_t *h, calc_ctx_t *c)
+{
+    unsigned char stack [5][6], reg [DATA_NREGS][6];
+
+    calc_hle_get_stack (h, stack);
+    calc_hle_get_regs (h, reg);
+    calc_ctx_write_stack (c, stack);
+    calc_ctx_write_regs (c, reg);
+    calc_ctx_write_pc (c, h->pc);
+}
+
+void calc_hle_get_stack (const calc_hle_t *h, unsigned char stack[][6])
+{
+    int i;
+
+    for (i=0; i<5; i++)
+        num_encode (h->stack[i], stack[i]);
+}
+
+void calc_hle_get_regs (const calc_hle_t *h, unsigned char reg[][6])
+{
+    int i;
+
+    for (i=0; i<DATA_NREGS; i++)
+        num_encode (h->reg[i], reg[i]);
+}
+
+//
+// Differential mode.
+// ПП is held for one step, then the calculator runs until
+// the idle tracker finds it waiting for the next key.
+//
+#define DIFF_HOLD_WORDS     560
+#define DIFF_MAX_STEPS      5000
+
+static void diff_display (calc_ctx_t *c, int i, int digit, int dot)
+{
+}
+
+//
+// Compare values, not encodings: the calculator may keep
+// a mantissa unnormalized.
+//
+static int diff_same (unsigned char a[][6], unsigned char b[][6], int n)
+{
+    int i;
+
+    for (i=0; i<n; i++) {
+        hle_num_t x = num_decode (a[i]);
+        hle_num_t y = num_decode (b[i]);
+
+        if (x.mant != y.mant || x.neg != y.neg ||
+            (x.mant != 0 && x.exp != y.exp))
+            return 0;
+    }
+    return 1;
+}
+
+int calc_hle_diff (calc_ctx_t *c, unsigned long max_insns, calc_hle_diff_t *r)
+{
+    void (*display) (calc_ctx_t*, int, int, int) = c->display;
+    void (*frame) (calc_ctx_t*, const calc_frame_t*) = c->frame;
+    calc_idle_t *saved_idle = c->idle;
+    calc_keyq_t keyq = c->keyq;
+    int input = c->input, rgd_mode = c->rgd_mode;
+    calc_idle_t idle;
+    calc_hle_t h;
+    int steps, status = CALC_HLE_RUN;
+
+    calc_hle_load (&h, c);
+    c->display = diff_display;
+    c->frame = 0;
+    c->keyq.count = 0;
+    calc_ctx_set_rgd (c, h.rgd);
+    calc_ctx_set_idle (c, &idle);
+    memset (r, 0, sizeof *r);
+
+    for (r->insns=0; r->insns<max_insns; r->insns++) {
+        r->pc = h.pc;
+        r->opcode = (h.pc < CODE_NBYTES) ? h.code [h.pc] : 0xff;
+        status = calc_hle_step (&h);
+        if (status == CALC_HLE_UNSUPPORTED || status == CALC_HLE_ERROR)
+            break;
+
+        calc_ctx_press (c, KEY_CALL, DIFF_HOLD_WORDS);
+        for (steps=0; steps<DIFF_MAX_STEPS; steps++) {
+            calc_ctx_step (c);
+            if (calc_ctx_keys_queued (c) == 0 && calc_ctx_idle (c))
+                break;
+        }
+
+        r->calc_pc = calc_ctx_get_pc (c);
+        r->hle_pc = h.pc;
+        calc_ctx_get_stack (c, r->calc_stack);
+        calc_ctx_get_regs (c, r->calc_regs);
+        calc_hle_get_stack (&h, r->hle_stack);
+        calc_hle_get_regs (&h, r->hle_regs);
+        if (r->calc_pc != r->hle_pc ||
+            ! diff_same (r->calc_stack, r->hle_stack, 5) ||
+            ! diff_same (r->calc_regs, r->hle_regs, DATA_NREGS)) {
+            status = -1;
+            break;
+        }
+        if (status == CALC_HLE_STOP) {
+            r->insns++;
+            break;
+        }
+    }
+
+    c->display = display;
+    c->frame = frame;
+    c->keyq = keyq;
+    c->input = input;
+    c->rgd_mode = rgd_mode;
+    calc_ctx_set_idle (c, saved_idle);
+    return status;
+}
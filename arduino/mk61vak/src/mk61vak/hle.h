@@ -0,0 +1,119 @@
+/*
+ * High-level emulation of MK-61 user programs.
+ *
+ * Interprets the program code one opcode at a time, with the
+ * stack and registers kept as decimal numbers, instead of
+ * simulating the chips. Addition, subtraction, multiplication,
+ * division and square root round the way the ROM does. The
+ * exponential, logarithmic and trigonometric functions and x^y
+ * are left to the chips: calc_hle_step() reports them unsupported.
+ * calc_hle_store() hands the result back to the context, and
+ * calc_hle_diff() checks a program against calc_ctx_step()
+ * instruction by instruction.
+ */
+#pragma once
+
+#include "calc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t mant;                      // Eight digits 10000000...99999999, or 0
+    int16_t exp;                        // Decimal exponent of the first digit
+    uint8_t neg;                        // Negative mantissa
+} hle_num_t;
+
+typedef struct {
+    unsigned char code [CODE_NBYTES];
+    hle_num_t stack [5];                // X1, X, Y, Z, T as in calc_get_stack()
+    hle_num_t reg [DATA_NREGS];
+    uint8_t ret [5];                    // Return stack, most recent first
+    uint8_t pc;                         // Address of the next instruction
+    uint8_t rgd;                        // MODE_* switch position
+    uint8_t lift;                       // Next number pushes the stack
+    uint8_t entry;                      // Typing a number: 1 mantissa, 2 exponent
+    uint8_t ndigits;                    // Mantissa digits typed
+    int8_t point;                       // Digits before the point, or HLE_NO_POINT
+    uint8_t mneg;                       // Mantissa sign typed
+    uint8_t eneg;                       // Exponent sign typed
+    uint8_t edigits;                    // Exponent typed, 0...99
+    uint32_t digits;                    // Mantissa typed
+} calc_hle_t;
+
+#define HLE_NO_POINT    (-128)
+
+//
+// Status of calc_hle_step() and calc_hle_run().
+//
+#define CALC_HLE_RUN            0       // Next instruction may follow
+#define CALC_HLE_STOP           1       // Stopped at С/П
+#define CALC_HLE_ERROR          2       // ЕГГОГ: the calculator stops too
+#define CALC_HLE_UNSUPPORTED    3       // Opcode or operand not emulated, pc unchanged
+
+//
+// Load program, stack, registers, program counter and
+// the rgd switch from a context. Number entry and the return
+// stack start empty, as after С/П or В/О.
+//
+void calc_hle_load (calc_hle_t *h, calc_ctx_t *c);
+
+//
+// Write the stack, registers and program counter back to a
+// context, to go on with the chips from there. Call while
+// the HLE is stopped or before an unsupported instruction.
+//
+void calc_hle_store (const calc_hle_t *h, calc_ctx_t *c);
+
+//
+// Execute one instruction at h->pc.
+//
+int calc_hle_step (calc_hle_t *h);
+
+//
+// Execute at most max_insns instructions, stopping at С/П,
+// error or an unsupported instruction.
+// Return the status of the last one; *count is set to
+// the number of instructions executed, when not null.
+//
+int calc_hle_run (calc_hle_t *h, unsigned long max_insns, unsigned long *count);
+
+//
+// Stack and registers in the format of calc_ctx_get_stack()
+// and calc_ctx_get_regs().
+//
+void calc_hle_get_stack (const calc_hle_t *h, unsigned char stack[][6]);
+void calc_hle_get_regs (const calc_hle_t *h, unsigned char reg[][6]);
+
+//
+// Result of calc_hle_diff(): the first instruction after which
+// the two engines disagree.
+//
+typedef struct {
+    unsigned long insns;                // Instructions executed in agreement
+    unsigned pc;                        // Address of the instruction compared last
+    unsigned char opcode;
+    unsigned calc_pc;                   // Program counters after it
+    unsigned hle_pc;
+    unsigned char calc_stack [5][6];    // Stacks and registers after it
+    unsigned char hle_stack [5][6];
+    unsigned char calc_regs [DATA_NREGS][6];
+    unsigned char hle_regs [DATA_NREGS][6];
+} calc_hle_diff_t;
+
+//
+// Differential mode: load the HLE from the context, then single-step
+// both, the calculator by pressing ПП in automatic mode, comparing
+// the program counter, stack and registers after each instruction.
+// Keys are pressed through the input queue; the display callbacks,
+// the queue and the idle tracker of the context are restored on return.
+// Return -1 on the first divergence, else the HLE status
+// after at most max_insns instructions; r describes the last
+// instruction compared.
+//
+int calc_hle_diff (calc_ctx_t *c, unsigned long max_insns, calc_hle_diff_t *r);
+
+#ifdef __cplusplus
+}
+#endif
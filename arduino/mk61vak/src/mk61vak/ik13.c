@@ -26,22 +26,127 @@
 #include "compat.h"
 #include "calc.h"
 
+//
+// Decoded ROM sets, shared by all PLM instances.
+//
+static plm_rom_t rom_cache [PLM_NROMS];
+static unsigned rom_count;
+
+//
+// Decode one micro-instruction word into table form.
+//
+static void ucode_decode (plm_ucode_t *u, uint32_t op)
+{
+    u->alpha_r   = (op & UCMD_ALPHA_R)  ? 0xf : 0;
+    u->alpha_m   = (op & UCMD_ALPHA_M)  ? 0xf : 0;
+    u->alpha_st  = (op & UCMD_ALPHA_ST) ? 0xf : 0;
+    u->alpha_nr  = (op & UCMD_ALPHA_NR) ? 0xf : 0;
+    u->alpha_s   = (op & UCMD_ALPHA_S)  ? 0xf : 0;
+    u->alpha_c10 = (op & UCMD_ALPHA_C10) ? 0xa : 0;
+    u->alpha_k   = (op & UCMD_ALPHA_4)  ? 4 : 0;
+
+    u->beta_s    = (op & UCMD_BETA_S)   ? 0xf : 0;
+    u->beta_ns   = (op & UCMD_BETA_NS)  ? 0xf : 0;
+    u->beta_q    = (op & UCMD_BETA_Q)   ? 0xf : 0;
+    u->beta_k    = ((op & UCMD_BETA_6)  ? 6 : 0) |
+                   ((op & UCMD_BETA_1)  ? 1 : 0);
+
+    u->gamma_c    = (op & UCMD_GAMMA_CARRY)  ? 1 : 0;
+    u->gamma_nc   = (op & UCMD_GAMMA_NCARRY) ? 1 : 0;
+    u->gamma_nkey = (op & UCMD_GAMMA_NKEY)   ? 1 : 0;
+
+    u->wr = ((op & UCMD_R_MASK) >> 15) | ((op & UCMD_S_MASK) >> 22) << 3;
+
+    u->flags = 0;
+    if (op & UCMD_R1_SUM)    u->flags |= PLM_U_R1_SUM;
+    if (op & UCMD_R2_SUM)    u->flags |= PLM_U_R2_SUM;
+    if (op & UCMD_M_S)       u->flags |= PLM_U_M_S;
+    if (op & UCMD_CARRY_SUM) u->flags |= PLM_U_CARRY_SUM;
+    if (op & UCMD_Q_SUM)     u->flags |= PLM_U_Q_SUM;
+    if (op & UCMD_KEYPAD)    u->flags |= PLM_U_KEYPAD;
+    if (op & UCMD_ST_SUM)    u->flags |= PLM_U_ST_SUM;
+    if (op & UCMD_ST_ROT)    u->flags |= PLM_U_ST_ROT;
+}
+
+//
+// Resolve the micro-address sequence of one instruction word.
+//
+void plm_useq_decode (uint8_t useq[], const uint8_t prog_rom[],
+    uint32_t command)
+{
+    static const unsigned char remap[REG_NWORDS] = {
+        0,1,2,  3,4,5,  3,4,5,  3,4,5,  3,4,5,  3,4,5,  3,4,5,
+        3,4,5,  6,7,8,  0,1,2,  3,4,5,  6,7,8,  0,1,2,  3,4,5,
+    };
+    unsigned cycle, prog_index, inst_addr;
+
+    for (cycle=0; cycle<REG_NWORDS; cycle++) {
+        if (cycle < 27)
+            prog_index = command & 0xff;
+        else if (cycle < 36)
+            prog_index = (command >> 8) & 0xff;
+        else {
+            prog_index = (command >> 16) & 0xff;
+            if (prog_index > 0x1f)
+                prog_index = 0x5f;
+        }
+        inst_addr = pgm_read_byte(&prog_rom[prog_index*9 + remap[cycle]]) & 0x3f;
+        if (inst_addr >= 60)
+            inst_addr = (inst_addr + inst_addr - 60) | PLM_USEQ_CARRY;
+        useq[cycle] = inst_addr;
+    }
+}
+
+//
+// Find the decoded tables for a ROM set, building them on first use.
+// Only PLM_NROMS sets exist in a calculator; any extra one
+// recycles the oldest slot.
+//
+static const plm_rom_t *rom_lookup (const uint32_t inst_rom[],
+    const uint32_t cmd_rom[], const uint8_t prog_rom[],
+    const uint8_t useq_rom[][REG_NWORDS])
+{
+    plm_rom_t *r;
+    unsigned i;
+
+    for (i=0; i<rom_count && i<PLM_NROMS; i++) {
+        r = &rom_cache[i];
+        if (r->inst_rom == inst_rom && r->cmd_rom == cmd_rom &&
+            r->prog_rom == prog_rom && r->useq == useq_rom)
+            return r;
+    }
+    r = &rom_cache[rom_count++ % PLM_NROMS];
+#ifdef PLM_JIT
+    plm_jit_flush (r);
+#endif
+    r->inst_rom = inst_rom;
+    r->cmd_rom = cmd_rom;
+    r->prog_rom = prog_rom;
+    r->useq = useq_rom;
+    for (i=0; i<UCMD_NWORDS; i++)
+        ucode_decode (&r->ucode[i], pgm_read_dword_near(&inst_rom[i]));
+    return r;
+}
+
 //
 // Initialize the PLM data structure.
 //
 void plm_init (plm_t *t, const uint32_t inst_rom[],
-    const uint32_t cmd_rom[], const uint8_t prog_rom[])
+    const uint32_t cmd_rom[], const uint8_t prog_rom[],
+    const uint8_t useq_rom[][REG_NWORDS])
 {
     int i;
 
     t->inst_rom = inst_rom;
     t->cmd_rom = cmd_rom;
     t->prog_rom = prog_rom;
+    t->rom = rom_lookup (inst_rom, cmd_rom, prog_rom, useq_rom);
+    t->useq = t->rom->useq[0];
 
     for (i=0; i<REG_NWORDS; i++) {
-        t->R[i] = 0;
-        t->M[i] = 0;
-        t->ST[i] = 0;
+        nib_set (t->R, i, 0);
+        nib_set (t->M, i, 0);
+        nib_set (t->ST, i, 0);
     }
     t->input = 0;
     t->output = 0;
@@ -49,7 +154,6 @@ void plm_init (plm_t *t, const uint32_t inst_rom[],
     t->Q = 0;
     t->carry = 0;
     t->keypad_event = 0;
-    t->opcode = 0;
     t->keyb_x = 0;
     t->keyb_y = 0;
     t->dot = 0;
@@ -66,89 +170,147 @@ uint32_t plm_get_cmd_rom(plm_t *t, uint16_t pc)
 }
 
 //
-// Simulate one cycle of the PLM chip.
+// Save the chip state: registers two words a byte, then the flags.
 //
-void plm_step (plm_t *t, unsigned cycle)
+void plm_save (const plm_t *t, uint8_t buf[])
 {
-    /* D stage in range 0...13 */
-    unsigned d = cycle / 3;
+    unsigned i, dots = 0;
 
-    /*
-     * Fetch program counter from the R register.
-     */
-    if (cycle == 0) {
-        unsigned pc = t->R[36] + (t->R[39] << 4);
+    nib_pack (buf, t->R, REG_NWORDS);
+    buf += REG_NWORDS/2;
+    nib_pack (buf, t->M, REG_NWORDS);
+    buf += REG_NWORDS/2;
+    nib_pack (buf, t->ST, REG_NWORDS);
+    buf += REG_NWORDS/2;
 
-        t->command = pgm_read_dword_near(&t->cmd_rom[pc]);
-        if ((t->command & 0xfc0000) == 0)
-            t->keypad_event = 0;
-    }
+    for (i=0; i<14; i++)
+        dots |= (t->show_dot[i] != 0) << i;
 
-    /*
-     * Use PC to get the program index.
-     */
-    unsigned prog_index;
-    if (cycle < 27)
-        prog_index = t->command & 0xff;
-    else if (cycle < 36)
-        prog_index = (t->command >> 8) & 0xff;
-    else {
-        prog_index = (t->command >> 16) & 0xff;
-        if (prog_index > 0x1f) {
-            if (cycle == 36) {
-                t->R[37] = prog_index & 0xf;
-                t->R[40] = prog_index >> 4;
-            }
-            prog_index = 0x5f;
-        }
+    buf[0] = t->input;
+    buf[1] = t->output;
+    buf[2] = t->S;
+    buf[3] = t->Q;
+    buf[4] = t->carry;
+    buf[5] = t->keypad_event;
+    buf[6] = t->keyb_x;
+    buf[7] = t->keyb_y;
+    buf[8] = t->dot;
+    buf[9] = t->enable_display;
+    buf[10] = t->command;
+    buf[11] = t->command >> 8;
+    buf[12] = t->command >> 16;
+    buf[13] = t->command >> 24;
+    buf[14] = dots;
+    buf[15] = dots >> 8;
+}
+
+//
+// Load the chip state saved by plm_save().
+//
+void plm_load (plm_t *t, const uint8_t buf[])
+{
+    unsigned i, pc, dots;
+
+    nib_unpack (t->R, buf, REG_NWORDS);
+    buf += REG_NWORDS/2;
+    nib_unpack (t->M, buf, REG_NWORDS);
+    buf += REG_NWORDS/2;
+    nib_unpack (t->ST, buf, REG_NWORDS);
+    buf += REG_NWORDS/2;
+
+    t->input = buf[0];
+    t->output = buf[1];
+    t->S = buf[2];
+    t->Q = buf[3];
+    t->carry = buf[4];
+    t->keypad_event = buf[5];
+    t->keyb_x = buf[6];
+    t->keyb_y = buf[7];
+    t->dot = buf[8];
+    t->enable_display = buf[9];
+    t->command = buf[10] | buf[11] << 8 | (uint32_t) buf[12] << 16 |
+        (uint32_t) buf[13] << 24;
+    dots = buf[14] | buf[15] << 8;
+    for (i=0; i<14; i++)
+        t->show_dot[i] = (dots >> i) & 1;
+
+    // Fetched again at the next word; keep it valid meanwhile.
+    pc = nib_get (t->R, 36) + (nib_get (t->R, 39) << 4);
+    t->useq = t->rom->useq[pc];
+}
+
+//
+// Fetch the instruction at the program counter held in R.
+//
+static inline void plm_fetch (plm_t *t)
+{
+    unsigned pc = nib_get (t->R, 36) + (nib_get (t->R, 39) << 4);
+
+    t->command = pgm_read_dword_near(&t->cmd_rom[pc]);
+    t->useq = t->rom->useq[pc];
+    if ((t->command & 0xfc0000) == 0)
+        t->keypad_event = 0;
+}
+
+//
+// Last third of the word may load a constant into R.
+//
+static inline void plm_load_const (plm_t *t)
+{
+    unsigned prog_index = (t->command >> 16) & 0xff;
+
+    if (prog_index > 0x1f) {
+        nib_set (t->R, 37, prog_index & 0xf);
+        nib_set (t->R, 40, prog_index >> 4);
     }
-    unsigned modifier = (t->command >> 24) & 0xff;
+}
+
+//
+// Execute the micro-instruction of one cycle, without the M input/output.
+// scan: the command polls keypad and display; wr: R may be written.
+//
+static inline void plm_cycle (plm_t *t, const plm_ucode_t ucode[],
+    unsigned inst_addr, unsigned cycle, int scan, int wr)
+{
+    /* D stage in range 0...13 */
+    unsigned d = cycle / 3;
 
     /*
-     * Fetch the instruction opcode.
+     * Resolve a carry-dependent micro-address.
      */
-    const unsigned char remap[42] = {
-        0,1,2,  3,4,5,  3,4,5,  3,4,5,  3,4,5,  3,4,5,  3,4,5,
-        3,4,5,  6,7,8,  0,1,2,  3,4,5,  6,7,8,  0,1,2,  3,4,5,
-    };
-    unsigned inst_addr = pgm_read_byte(&t->prog_rom[prog_index*9 + remap[cycle]]) & 0x3f;
-    if (inst_addr >= 60) {
-        inst_addr += inst_addr - 60;
+    if (inst_addr & PLM_USEQ_CARRY) {
+        inst_addr &= ~PLM_USEQ_CARRY;
         if (! t->carry)
             inst_addr++;
     }
-    t->opcode = pgm_read_dword_near(&t->inst_rom[inst_addr]);
+    const plm_ucode_t *u = &ucode[inst_addr];
 
     /*
      * Execute the opcode.
      */
-    unsigned alpha = 0, beta = 0, gamma = 0;
-    if (t->opcode & UCMD_KEYPAD) {
+    unsigned alpha, beta, gamma;
+    if (u->flags & PLM_U_KEYPAD) {
         if (d != (t->keyb_x - 1) && t->keyb_y > 0)
             t->Q = t->keyb_y;
     }
 
     /* Alpha. */
-    if (t->opcode & UCMD_ALPHA_R)   alpha |= t->R[cycle];
-    if (t->opcode & UCMD_ALPHA_M)   alpha |= t->M[cycle];
-    if (t->opcode & UCMD_ALPHA_ST)  alpha |= t->ST[cycle];
-    if (t->opcode & UCMD_ALPHA_NR)  alpha |= t->R[cycle] ^ 0xf;
-    if (t->opcode & UCMD_ALPHA_C10
-        && ! t->carry)              alpha |= 0xa;
-    if (t->opcode & UCMD_ALPHA_S)   alpha |= t->S;
-    if (t->opcode & UCMD_ALPHA_4)   alpha |= 4;
+    unsigned r = nib_get (t->R, cycle);
+    alpha = (r & u->alpha_r) | ((r ^ 0xf) & u->alpha_nr) |
+            (nib_get (t->M, cycle) & u->alpha_m) |
+            (nib_get (t->ST, cycle) & u->alpha_st) |
+            (t->S & u->alpha_s) | u->alpha_k;
+    if (! t->carry)
+        alpha |= u->alpha_c10;
 
     /* Beta. */
-    if (t->opcode & UCMD_BETA_S)    beta |= t->S;
-    if (t->opcode & UCMD_BETA_NS)   beta |= t->S ^ 0xf;
-    if (t->opcode & UCMD_BETA_Q)    beta |= t->Q;
-    if (t->opcode & UCMD_BETA_6)    beta |= 6;
-    if (t->opcode & UCMD_BETA_1)    beta |= 1;
+    beta = (t->S & u->beta_s) | ((t->S ^ 0xf) & u->beta_ns) |
+           (t->Q & u->beta_q) | u->beta_k;
 
     /*
      * Poll keypad.
      */
-    if (t->command & 0xfc0000) {
+    if (! scan) {
         if (t->keyb_y == 0)
             t->keypad_event = 0;
     } else {
@@ -165,19 +327,18 @@ void plm_step (plm_t *t, unsigned cycle)
     }
 
     /* Gamma. */
-    if (t->opcode & UCMD_GAMMA_CARRY)   gamma |= t->carry;
-    if (t->opcode & UCMD_GAMMA_NCARRY)  gamma |= t->carry ^ 1;
-    if (t->opcode & UCMD_GAMMA_NKEY)    gamma |= t->keypad_event ^ 1;
+    gamma = (t->carry & u->gamma_c) | ((t->carry ^ 1) & u->gamma_nc) |
+            ((t->keypad_event ^ 1) & u->gamma_nkey);
 
     /*
      * Compute sum and carry.
      */
     unsigned sum = alpha + beta + gamma;
-    if (t->opcode & UCMD_CARRY_SUM)
+    if (u->flags & PLM_U_CARRY_SUM)
         t->carry = (sum >> 4) & 1;
     sum &= 0xf;
 
-    if (modifier == 0 || cycle >= 36) {
+    if (wr) {
         /*
          * Update R register.
          */
@@ -191,38 +352,40 @@ void plm_step (plm_t *t, unsigned cycle)
         if (cycle_minus_2 >= REG_NWORDS)
             cycle_minus_2 -= REG_NWORDS;
 
-        switch (t->opcode & UCMD_R_MASK) {
-        case UCMD_R_R3:     t->R[cycle]  = t->R[cycle_plus_3];  break;
-        case UCMD_R_SUM:    t->R[cycle]  = sum;                 break;
-        case UCMD_R_S:      t->R[cycle]  = t->S;                break;
-        case UCMD_R_RSSUM:  t->R[cycle] |= t->S | sum;          break;
-        case UCMD_R_SSUM:   t->R[cycle]  = t->S | sum;          break;
-        case UCMD_R_RS:     t->R[cycle] |= t->S;                break;
-        case UCMD_R_RSUM:   t->R[cycle] |= sum;                 break;
+        switch (PLM_WR_R(u->wr)) {
+        case UCMD_R_R3 >> 15:    r = nib_get (t->R, cycle_plus_3);   break;
+        case UCMD_R_SUM >> 15:   r = sum;                           break;
+        case UCMD_R_S >> 15:     r = t->S;                          break;
+        case UCMD_R_RSSUM >> 15: r |= t->S | sum;                   break;
+        case UCMD_R_SSUM >> 15:  r = t->S | sum;                    break;
+        case UCMD_R_RS >> 15:    r |= t->S;                         break;
+        case UCMD_R_RSUM >> 15:  r |= sum;                          break;
         }
-        if (t->opcode & UCMD_R1_SUM) t->R[cycle_minus_1] = sum;
-        if (t->opcode & UCMD_R2_SUM) t->R[cycle_minus_2] = sum;
+        if (PLM_WR_R(u->wr))
+            nib_set (t->R, cycle, r);
+        if (u->flags & PLM_U_R1_SUM) nib_set (t->R, cycle_minus_1, sum);
+        if (u->flags & PLM_U_R2_SUM) nib_set (t->R, cycle_minus_2, sum);
     }
 
     /*
      * Update M register.
      */
-    if (t->opcode & UCMD_M_S)
-        t->M[cycle] = t->S;
+    if (u->flags & PLM_U_M_S)
+        nib_set (t->M, cycle, t->S);
 
     /*
      * Update S register.
      */
-    switch (t->opcode & UCMD_S_MASK) {
-    case UCMD_S_Q:      t->S = t->Q;        break;
-    case UCMD_S_SUM:    t->S = sum;         break;
-    case UCMD_S_QSUM:   t->S = t->Q | sum;  break;
+    switch (PLM_WR_S(u->wr)) {
+    case UCMD_S_Q >> 22:    t->S = t->Q;        break;
+    case UCMD_S_SUM >> 22:  t->S = sum;         break;
+    case UCMD_S_QSUM >> 22: t->S = t->Q | sum;  break;
     }
 
     /*
      * Update Q register.
      */
-    if (t->opcode & UCMD_Q_SUM)
+    if (u->flags & PLM_U_Q_SUM)
         t->Q = sum;
 
     /*
@@ -235,21 +398,66 @@ void plm_step (plm_t *t, unsigned cycle)
     if (cycle_plus_2 >= REG_NWORDS)
         cycle_plus_2 -= REG_NWORDS;
 
-    if (t->opcode & UCMD_ST_SUM) {
-        t->ST[cycle_plus_2] = t->ST[cycle_plus_1];
-        t->ST[cycle_plus_1] = t->ST[cycle];
-        t->ST[cycle]        = sum;
+    if (u->flags & PLM_U_ST_SUM) {
+        nib_set (t->ST, cycle_plus_2, nib_get (t->ST, cycle_plus_1));
+        nib_set (t->ST, cycle_plus_1, nib_get (t->ST, cycle));
+        nib_set (t->ST, cycle, sum);
     }
-    if (t->opcode & UCMD_ST_ROT) {
-        unsigned x = t->ST[cycle];
-        t->ST[cycle]        = t->ST[cycle_plus_1];
-        t->ST[cycle_plus_1] = t->ST[cycle_plus_2];
-        t->ST[cycle_plus_2] = x;
+    if (u->flags & PLM_U_ST_ROT) {
+        unsigned x = nib_get (t->ST, cycle);
+        nib_set (t->ST, cycle, nib_get (t->ST, cycle_plus_1));
+        nib_set (t->ST, cycle_plus_1, nib_get (t->ST, cycle_plus_2));
+        nib_set (t->ST, cycle_plus_2, x);
     }
+}
+
+//
+// Simulate one cycle of the PLM chip.
+//
+void plm_step (plm_t *t, unsigned cycle)
+{
+    if (cycle == 0)
+        plm_fetch (t);
+    if (cycle == 36)
+        plm_load_const (t);
+
+    plm_cycle (t, t->rom->ucode, pgm_read_byte(&t->useq[cycle]), cycle,
+        (t->command & 0xfc0000) == 0,
+        (t->command >> 24) == 0 || cycle >= 36);
 
     /*
      * Store input, pass output.
      */
-    t->output = t->M[cycle] & 0xf;
-    t->M[cycle] = t->input;
+    t->output = nib_get (t->M, cycle) & 0xf;
+    nib_set (t->M, cycle, t->input);
+}
+
+//
+// Simulate all 42 cycles of one word of the PLM chip.
+//
+void plm_step_word (plm_t *t, const uint8_t in[], uint8_t out[])
+{
+    const plm_ucode_t *ucode = t->rom->ucode;
+    const uint8_t *useq;
+    unsigned cycle;
+    int scan, wr;
+
+    plm_fetch (t);
+    useq = t->useq;
+    scan = (t->command & 0xfc0000) == 0;
+    wr = (t->command >> 24) == 0;
+
+    for (cycle=0; cycle<36; cycle++) {
+        plm_cycle (t, ucode, pgm_read_byte(&useq[cycle]), cycle, scan, wr);
+        out[cycle] = nib_get (t->M, cycle) & 0xf;
+        nib_set (t->M, cycle, in[cycle]);
+    }
+    plm_load_const (t);
+    for (; cycle<REG_NWORDS; cycle++) {
+        plm_cycle (t, ucode, pgm_read_byte(&useq[cycle]), cycle, scan, 1);
+        out[cycle] = nib_get (t->M, cycle) & 0xf;
+        nib_set (t->M, cycle, in[cycle]);
+    }
+    t->input = in[REG_NWORDS-1];
+    t->output = out[REG_NWORDS-1];
 }
@@ -32,7 +32,7 @@ void fifo_init (fifo_t *t)
     int i;
 
     for (i=0; i<FIFO_NWORDS; i++)
-        t->data[i] = 0;
+        nib_set (t->data, i, 0);
     t->input = 0;
     t->output = 0;
     t->cycle = 0;
@@ -43,9 +43,42 @@ void fifo_init (fifo_t *t)
 //
 void fifo_step (fifo_t *t)
 {
-    t->output = t->data[t->cycle];
-    t->data[t->cycle] = t->input;
+    t->output = nib_get (t->data, t->cycle);
+    nib_set (t->data, t->cycle, t->input);
     t->cycle++;
     if (t->cycle >= FIFO_NWORDS)
         t->cycle = 0;
 }
+
+//
+// Save the FIFO: memory two words a byte, then the other fields.
+//
+void fifo_save (const fifo_t *t, uint8_t buf[])
+{
+    nib_pack (buf, t->data, FIFO_NWORDS);
+    buf += FIFO_NWORDS/2;
+    buf[0] = t->input;
+    buf[1] = t->output;
+    buf[2] = t->cycle;
+    buf[3] = t->cycle >> 8;
+}
+
+//
+// Load the FIFO saved by fifo_save().
+// The cycle advances a word at a time: anything else
+// would run fifo_word() past the end of the memory.
+//
+int fifo_load (fifo_t *t, const uint8_t buf[])
+{
+    unsigned cycle = buf[FIFO_NWORDS/2 + 2] | buf[FIFO_NWORDS/2 + 3] << 8;
+
+    if (cycle >= FIFO_NWORDS || cycle % REG_NWORDS != 0)
+        return -1;
+
+    nib_unpack (t->data, buf, FIFO_NWORDS);
+    buf += FIFO_NWORDS/2;
+    t->input = buf[0];
+    t->output = buf[1];
+    t->cycle = cycle;
+    return 0;
+}
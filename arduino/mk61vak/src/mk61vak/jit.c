@@ -0,0 +1,595 @@
+/*
+ * Native code tier for К145ИК130x instruction words.
+ *
+ * Counts how often each instruction of each ROM set is run a word
+ * at a time, and once an instruction is hot, translates all 42 cycles
+ * of it into x86-64 machine code with the same semantics as plm_step().
+ * Cold instructions stay with the interpreter.
+ *
+ * Host only: x86-64 with the System V calling convention.
+ * Not thread-safe: enable it only while a single thread runs contexts.
+ */
+#ifdef PLM_JIT
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "compat.h"
+#include "calc.h"
+
+#if !defined(__x86_64__) || defined(_WIN32)
+#error "PLM_JIT needs x86-64 with the System V ABI"
+#endif
+#ifdef PLM_PACKED
+#error "PLM_JIT needs one byte per register word, not PLM_PACKED"
+#endif
+
+#ifndef PLM_JIT_HOT
+#define PLM_JIT_HOT     64              // Words run before an instruction is compiled
+#endif
+
+#define JIT_MAXCODE     32768           // Bytes of machine code per word, at most
+
+//
+// Compiled instructions of one ROM set.
+//
+typedef struct {
+    const plm_rom_t *rom;               // Key: decoded ROM set
+    uint16_t hits [CMD_NWORDS];         // Words run, up to PLM_JIT_HOT+1
+    plm_word_t code [CMD_NWORDS];       // Native code, or 0
+    size_t size [CMD_NWORDS];           // Bytes mapped for code[]
+} jit_rom_t;
+
+static jit_rom_t jit_cache [PLM_NROMS];
+static unsigned jit_next;
+static int jit_on;
+static unsigned jit_words;
+static size_t jit_bytes;
+
+//
+// Code buffer.
+//
+typedef struct {
+    uint8_t *p;
+    size_t len;
+    int overflow;
+} jit_buf_t;
+
+/* Registers */
+enum { RAX = 0, RCX = 1, RDX = 2, RSI = 6, RDI = 7, R8 = 8, R9 = 9, R10 = 10 };
+
+/* Arguments: plm_t *t, const uint8_t in[], uint8_t out[] */
+#define T       RDI
+#define IN      RSI
+#define OUT     RDX
+
+/* Working registers */
+#define A       RCX                     // alpha
+#define B       R9                      // beta
+#define SUM     RAX                     // alpha + beta + gamma
+#define X       R8                      // scratch
+#define Y       R10
+
+/* Two-operand ALU opcodes, r/m32 := r/m32 op r32 */
+enum { OP_ADD = 0x01, OP_OR = 0x09, OP_AND = 0x21, OP_XOR = 0x31, OP_MOV = 0x89 };
+
+/* Group 1 extensions, r/m32 op imm8 */
+enum { G_ADD = 0, G_OR = 1, G_AND = 4, G_SUB = 5, G_XOR = 6, G_CMP = 7 };
+
+/* Condition codes for jcc */
+enum { CC_E = 0x84, CC_NE = 0x85 };
+
+/* Field offsets */
+#define OFF_R(i)        (offsetof(plm_t, R) + (i))
+#define OFF_M(i)        (offsetof(plm_t, M) + (i))
+#define OFF_ST(i)       (offsetof(plm_t, ST) + (i))
+#define OFF_SHOW_DOT(i) (offsetof(plm_t, show_dot) + (i))
+#define OFF_S           offsetof(plm_t, S)
+#define OFF_Q           offsetof(plm_t, Q)
+#define OFF_CARRY       offsetof(plm_t, carry)
+#define OFF_KEYPAD_EVENT offsetof(plm_t, keypad_event)
+#define OFF_KEYB_X      offsetof(plm_t, keyb_x)
+#define OFF_KEYB_Y      offsetof(plm_t, keyb_y)
+#define OFF_DOT         offsetof(plm_t, dot)
+#define OFF_ENABLE_DISPLAY offsetof(plm_t, enable_display)
+
+static void emit1 (jit_buf_t *b, unsigned byte)
+{
+    if (b->len < JIT_MAXCODE)
+        b->p[b->len++] = byte;
+    else
+        b->overflow = 1;
+}
+
+static void emit4 (jit_buf_t *b, uint32_t word)
+{
+    emit1 (b, word);
+    emit1 (b, word >> 8);
+    emit1 (b, word >> 16);
+    emit1 (b, word >> 24);
+}
+
+//
+// REX prefix and ModRM for reg, [base + disp32].
+// REX is always present, so that byte registers are the low bytes.
+//
+static void emit_mem (jit_buf_t *b, unsigned opcode, int reg, int base, unsigned disp)
+{
+    emit1 (b, 0x40 | (reg >> 3) << 2 | (base >> 3));
+    if (opcode > 0xff)
+        emit1 (b, opcode >> 8);
+    emit1 (b, opcode & 0xff);
+    emit1 (b, 0x80 | (reg & 7) << 3 | (base & 7));
+    emit4 (b, disp);
+}
+
+/* movzx reg, byte [base + disp] */
+static void ld8 (jit_buf_t *b, int reg, int base, unsigned disp)
+{
+    emit_mem (b, 0x0fb6, reg, base, disp);
+}
+
+/* mov reg, dword [base + disp] */
+static void ld32 (jit_buf_t *b, int reg, int base, unsigned disp)
+{
+    emit_mem (b, 0x8b, reg, base, disp);
+}
+
+/* mov byte [base + disp], reg */
+static void st8 (jit_buf_t *b, int base, unsigned disp, int reg)
+{
+    emit_mem (b, 0x88, reg, base, disp);
+}
+
+/* or byte [base + disp], reg */
+static void or8 (jit_buf_t *b, int base, unsigned disp, int reg)
+{
+    emit_mem (b, 0x08, reg, base, disp);
+}
+
+/* mov byte [base + disp], imm */
+static void st8i (jit_buf_t *b, int base, unsigned disp, unsigned imm)
+{
+    emit_mem (b, 0xc6, 0, base, disp);
+    emit1 (b, imm);
+}
+
+/* mov dword [base + disp], imm */
+static void st32i (jit_buf_t *b, int base, unsigned disp, uint32_t imm)
+{
+    emit_mem (b, 0xc7, 0, base, disp);
+    emit4 (b, imm);
+}
+
+/* cmp byte [base + disp], imm */
+static void cmp8i (jit_buf_t *b, int base, unsigned disp, unsigned imm)
+{
+    emit_mem (b, 0x80, G_CMP, base, disp);
+    emit1 (b, imm);
+}
+
+/* cmp dword [base + disp], imm */
+static void cmp32i (jit_buf_t *b, int base, unsigned disp, unsigned imm)
+{
+    emit_mem (b, 0x83, G_CMP, base, disp);
+    emit1 (b, imm);
+}
+
+/* op dst, src (32-bit) */
+static void alu (jit_buf_t *b, unsigned opcode, int dst, int src)
+{
+    emit1 (b, 0x40 | (src >> 3) << 2 | (dst >> 3));
+    emit1 (b, opcode);
+    emit1 (b, 0xc0 | (src & 7) << 3 | (dst & 7));
+}
+
+/* op dst, imm8 (32-bit) */
+static void alui (jit_buf_t *b, unsigned ext, int dst, unsigned imm)
+{
+    emit1 (b, 0x40 | (dst >> 3));
+    emit1 (b, 0x83);
+    emit1 (b, 0xc0 | ext << 3 | (dst & 7));
+    emit1 (b, imm);
+}
+
+/* shr dst, imm8 */
+static void shri (jit_buf_t *b, int dst, unsigned imm)
+{
+    emit1 (b, 0x40 | (dst >> 3));
+    emit1 (b, 0xc1);
+    emit1 (b, 0xc0 | 5 << 3 | (dst & 7));
+    emit1 (b, imm);
+}
+
+/* Forward jumps: return the position of rel32 for patch() */
+static size_t jcc (jit_buf_t *b, unsigned cc)
+{
+    emit1 (b, 0x0f);
+    emit1 (b, cc);
+    emit4 (b, 0);
+    return b->len - 4;
+}
+
+static size_t jmp (jit_buf_t *b)
+{
+    emit1 (b, 0xe9);
+    emit4 (b, 0);
+    return b->len - 4;
+}
+
+static void patch (jit_buf_t *b, size_t pos)
+{
+    uint32_t rel = b->len - (pos + 4);
+
+    if (b->overflow)
+        return;
+    memcpy (b->p + pos, &rel, 4);
+}
+
+//
+// Translate one micro-instruction at the given cycle, see plm_step().
+//
+static void emit_ucode (jit_buf_t *b, const plm_ucode_t *u, unsigned cycle,
+    int scan, int wr)
+{
+    unsigned d = cycle / 3;
+    unsigned plus_1 = (cycle + 1) % REG_NWORDS;
+    unsigned plus_2 = (cycle + 2) % REG_NWORDS;
+    unsigned plus_3 = (cycle + 3) % REG_NWORDS;
+    unsigned minus_1 = (cycle + REG_NWORDS - 1) % REG_NWORDS;
+    unsigned minus_2 = (cycle + REG_NWORDS - 2) % REG_NWORDS;
+    size_t j1, j2;
+
+    if (u->flags & PLM_U_KEYPAD) {
+        /* if (d != keyb_x - 1 && keyb_y > 0) Q = keyb_y */
+        ld32 (b, X, T, OFF_KEYB_X);
+        alui (b, G_SUB, X, 1);
+        alui (b, G_CMP, X, d);
+        j1 = jcc (b, CC_E);
+        ld32 (b, X, T, OFF_KEYB_Y);
+        alui (b, G_CMP, X, 0);
+        j2 = jcc (b, CC_E);
+        st8 (b, T, OFF_Q, X);
+        patch (b, j1);
+        patch (b, j2);
+    }
+
+    /* Alpha. */
+    alu (b, OP_XOR, A, A);
+    if (u->alpha_r) {
+        ld8 (b, X, T, OFF_R(cycle));
+        alu (b, OP_OR, A, X);
+    }
+    if (u->alpha_nr) {
+        ld8 (b, X, T, OFF_R(cycle));
+        alui (b, G_XOR, X, 0xf);
+        alu (b, OP_OR, A, X);
+    }
+    if (u->alpha_m) {
+        ld8 (b, X, T, OFF_M(cycle));
+        alu (b, OP_OR, A, X);
+    }
+    if (u->alpha_st) {
+        ld8 (b, X, T, OFF_ST(cycle));
+        alu (b, OP_OR, A, X);
+    }
+    if (u->alpha_s) {
+        ld8 (b, X, T, OFF_S);
+        alu (b, OP_OR, A, X);
+    }
+    if (u->alpha_k)
+        alui (b, G_OR, A, u->alpha_k);
+    if (u->alpha_c10) {
+        cmp8i (b, T, OFF_CARRY, 0);
+        j1 = jcc (b, CC_NE);
+        alui (b, G_OR, A, u->alpha_c10);
+        patch (b, j1);
+    }
+
+    /* Beta. */
+    alu (b, OP_XOR, B, B);
+    if (u->beta_s) {
+        ld8 (b, X, T, OFF_S);
+        alu (b, OP_OR, B, X);
+    }
+    if (u->beta_ns) {
+        ld8 (b, X, T, OFF_S);
+        alui (b, G_XOR, X, 0xf);
+        alu (b, OP_OR, B, X);
+    }
+    if (u->beta_q) {
+        ld8 (b, X, T, OFF_Q);
+        alu (b, OP_OR, B, X);
+    }
+    if (u->beta_k)
+        alui (b, G_OR, B, u->beta_k);
+
+    /* Poll keypad. */
+    if (scan) {
+        st8i (b, T, OFF_ENABLE_DISPLAY, 1);
+        ld32 (b, X, T, OFF_KEYB_X);
+        alui (b, G_SUB, X, 1);
+        alui (b, G_CMP, X, d);
+        j1 = jcc (b, CC_NE);
+        ld32 (b, X, T, OFF_KEYB_Y);
+        alui (b, G_CMP, X, 0);
+        j2 = jcc (b, CC_E);
+        st8 (b, T, OFF_Q, X);
+        st8i (b, T, OFF_KEYPAD_EVENT, 1);
+        patch (b, j1);
+        patch (b, j2);
+        if (d < 12) {
+            cmp8i (b, T, OFF_CARRY, 0);
+            j1 = jcc (b, CC_E);
+            st32i (b, T, OFF_DOT, d);
+            patch (b, j1);
+        }
+        ld8 (b, X, T, OFF_CARRY);
+        st8 (b, T, OFF_SHOW_DOT(d), X);
+    } else {
+        cmp32i (b, T, OFF_KEYB_Y, 0);
+        j1 = jcc (b, CC_NE);
+        st8i (b, T, OFF_KEYPAD_EVENT, 0);
+        patch (b, j1);
+    }
+
+    /* Gamma, sum and carry. */
+    alu (b, OP_MOV, SUM, A);
+    alu (b, OP_ADD, SUM, B);
+    if (u->gamma_c | u->gamma_nc | u->gamma_nkey) {
+        alu (b, OP_XOR, Y, Y);
+        if (u->gamma_c) {
+            ld8 (b, X, T, OFF_CARRY);
+            alu (b, OP_OR, Y, X);
+        }
+        if (u->gamma_nc) {
+            ld8 (b, X, T, OFF_CARRY);
+            alui (b, G_XOR, X, 1);
+            alu (b, OP_OR, Y, X);
+        }
+        if (u->gamma_nkey) {
+            ld8 (b, X, T, OFF_KEYPAD_EVENT);
+            alui (b, G_XOR, X, 1);
+            alu (b, OP_OR, Y, X);
+        }
+        alu (b, OP_ADD, SUM, Y);
+    }
+    if (u->flags & PLM_U_CARRY_SUM) {
+        alu (b, OP_MOV, X, SUM);
+        shri (b, X, 4);
+        alui (b, G_AND, X, 1);
+        st8 (b, T, OFF_CARRY, X);
+    }
+    alui (b, G_AND, SUM, 0xf);
+
+    /* R register. */
+    if (wr) {
+        switch (PLM_WR_R(u->wr)) {
+        case UCMD_R_R3 >> 15:
+            ld8 (b, X, T, OFF_R(plus_3));
+            st8 (b, T, OFF_R(cycle), X);
+            break;
+        case UCMD_R_SUM >> 15:
+            st8 (b, T, OFF_R(cycle), SUM);
+            break;
+        case UCMD_R_S >> 15:
+            ld8 (b, X, T, OFF_S);
+            st8 (b, T, OFF_R(cycle), X);
+            break;
+        case UCMD_R_RSSUM >> 15:
+            ld8 (b, X, T, OFF_S);
+            alu (b, OP_OR, X, SUM);
+            or8 (b, T, OFF_R(cycle), X);
+            break;
+        case UCMD_R_SSUM >> 15:
+            ld8 (b, X, T, OFF_S);
+            alu (b, OP_OR, X, SUM);
+            st8 (b, T, OFF_R(cycle), X);
+            break;
+        case UCMD_R_RS >> 15:
+            ld8 (b, X, T, OFF_S);
+            or8 (b, T, OFF_R(cycle), X);
+            break;
+        case UCMD_R_RSUM >> 15:
+            or8 (b, T, OFF_R(cycle), SUM);
+            break;
+        }
+        if (u->flags & PLM_U_R1_SUM)
+            st8 (b, T, OFF_R(minus_1), SUM);
+        if (u->flags & PLM_U_R2_SUM)
+            st8 (b, T, OFF_R(minus_2), SUM);
+    }
+
+    /* M register. */
+    if (u->flags & PLM_U_M_S) {
+        ld8 (b, X, T, OFF_S);
+        st8 (b, T, OFF_M(cycle), X);
+    }
+
+    /* S register. */
+    switch (PLM_WR_S(u->wr)) {
+    case UCMD_S_Q >> 22:
+        ld8 (b, X, T, OFF_Q);
+        st8 (b, T, OFF_S, X);
+        break;
+    case UCMD_S_SUM >> 22:
+        st8 (b, T, OFF_S, SUM);
+        break;
+    case UCMD_S_QSUM >> 22:
+        ld8 (b, X, T, OFF_Q);
+        alu (b, OP_OR, X, SUM);
+        st8 (b, T, OFF_S, X);
+        break;
+    }
+
+    /* Q register. */
+    if (u->flags & PLM_U_Q_SUM)
+        st8 (b, T, OFF_Q, SUM);
+
+    /* ST register. */
+    if (u->flags & PLM_U_ST_SUM) {
+        ld8 (b, X, T, OFF_ST(plus_1));
+        st8 (b, T, OFF_ST(plus_2), X);
+        ld8 (b, X, T, OFF_ST(cycle));
+        st8 (b, T, OFF_ST(plus_1), X);
+        st8 (b, T, OFF_ST(cycle), SUM);
+    }
+    if (u->flags & PLM_U_ST_ROT) {
+        ld8 (b, X, T, OFF_ST(cycle));
+        ld8 (b, Y, T, OFF_ST(plus_1));
+        st8 (b, T, OFF_ST(cycle), Y);
+        ld8 (b, Y, T, OFF_ST(plus_2));
+        st8 (b, T, OFF_ST(plus_1), Y);
+        st8 (b, T, OFF_ST(plus_2), X);
+    }
+}
+
+//
+// Translate all 42 cycles of one instruction into buffer.
+//
+static void emit_word (jit_buf_t *b, const plm_rom_t *rom, uint32_t command,
+    const uint8_t useq[])
+{
+    int scan = (command & 0xfc0000) == 0;
+    unsigned modifier = (command >> 24) & 0xff;
+    unsigned prog_index = (command >> 16) & 0xff;
+    unsigned cycle, inst_addr;
+    size_t j1, j2;
+
+    for (cycle=0; cycle<REG_NWORDS; cycle++) {
+        int wr = (modifier == 0 || cycle >= 36);
+
+        if (cycle == 36 && prog_index > 0x1f) {
+            st8i (b, T, OFF_R(37), prog_index & 0xf);
+            st8i (b, T, OFF_R(40), prog_index >> 4);
+        }
+
+        inst_addr = pgm_read_byte(&useq[cycle]);
+        if (inst_addr & PLM_USEQ_CARRY) {
+            inst_addr &= ~PLM_USEQ_CARRY;
+            cmp8i (b, T, OFF_CARRY, 0);
+            j1 = jcc (b, CC_E);
+            emit_ucode (b, &rom->ucode[inst_addr], cycle, scan, wr);
+            j2 = jmp (b);
+            patch (b, j1);
+            emit_ucode (b, &rom->ucode[inst_addr + 1], cycle, scan, wr);
+            patch (b, j2);
+        } else {
+            emit_ucode (b, &rom->ucode[inst_addr], cycle, scan, wr);
+        }
+
+        /* Store input, pass output. */
+        ld8 (b, X, T, OFF_M(cycle));
+        alui (b, G_AND, X, 0xf);
+        st8 (b, OUT, cycle, X);
+        ld8 (b, X, IN, cycle);
+        st8 (b, T, OFF_M(cycle), X);
+    }
+    emit1 (b, 0xc3);                    // ret
+}
+
+//
+// Compile one instruction into executable memory.
+// Return 0 when out of memory or buffer space.
+//
+static plm_word_t jit_compile (jit_rom_t *j, unsigned pc)
+{
+    static uint8_t buf [JIT_MAXCODE];
+    jit_buf_t b = { buf, 0, 0 };
+    size_t page = sysconf (_SC_PAGESIZE);
+    size_t size;
+    void *mem;
+
+    emit_word (&b, j->rom, pgm_read_dword_near(&j->rom->cmd_rom[pc]),
+        j->rom->useq[pc]);
+    if (b.overflow)
+        return 0;
+
+    size = (b.len + page - 1) / page * page;
+    mem = mmap (0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED)
+        return 0;
+    memcpy (mem, buf, b.len);
+    if (mprotect (mem, size, PROT_READ | PROT_EXEC) != 0) {
+        munmap (mem, size);
+        return 0;
+    }
+    j->size[pc] = size;
+    jit_words++;
+    jit_bytes += b.len;
+    return (plm_word_t) mem;
+}
+
+//
+// Release all code of a slot.
+//
+static void jit_clear (jit_rom_t *j)
+{
+    unsigned pc;
+
+    for (pc=0; pc<CMD_NWORDS; pc++) {
+        if (j->code[pc])
+            munmap ((void*) j->code[pc], j->size[pc]);
+    }
+    memset (j, 0, sizeof(*j));
+}
+
+//
+// Find the slot of a ROM set, taking over the oldest one if needed.
+//
+static jit_rom_t *jit_find (const plm_rom_t *rom)
+{
+    jit_rom_t *j;
+    unsigned i;
+
+    for (i=0; i<PLM_NROMS; i++) {
+        if (jit_cache[i].rom == rom)
+            return &jit_cache[i];
+    }
+    j = &jit_cache[jit_next++ % PLM_NROMS];
+    jit_clear (j);
+    j->rom = rom;
+    return j;
+}
+
+void plm_jit_enable (int on)
+{
+    jit_on = on;
+}
+
+int plm_jit_enabled (void)
+{
+    return jit_on;
+}
+
+plm_word_t plm_jit_word (const plm_rom_t *rom, unsigned pc)
+{
+    jit_rom_t *j = jit_find (rom);
+
+    if (j->hits[pc] <= PLM_JIT_HOT) {
+        if (j->hits[pc]++ < PLM_JIT_HOT)
+            return 0;
+        j->code[pc] = jit_compile (j, pc);
+    }
+    return j->code[pc];
+}
+
+void plm_jit_flush (const plm_rom_t *rom)
+{
+    unsigned i;
+
+    for (i=0; i<PLM_NROMS; i++) {
+        if (jit_cache[i].rom == rom)
+            jit_clear (&jit_cache[i]);
+    }
+}
+
+void plm_jit_stats (unsigned *words, size_t *bytes)
+{
+    *words = jit_words;
+    *bytes = jit_bytes;
+}
+
+#endif /* PLM_JIT */
@@ -0,0 +1,444 @@
+/*
+ * Lane-parallel calculator engine.
+ *
+ * Same machine as calc_ctx_step(), plm_step() and fifo_step(),
+ * transposed so that one call advances CALC_LANES calculators.
+ * Every per-lane loop below is free of branches on lane data,
+ * so that it maps onto SIMD byte operations.
+ */
+#include <stdint.h>
+#include "compat.h"
+#include "lanes.h"
+
+//
+// Micro-instruction fields gathered for all lanes, see plm_ucode_t.
+//
+typedef struct {
+    uint8_t alpha_r [CALC_LANES];
+    uint8_t alpha_m [CALC_LANES];
+    uint8_t alpha_st [CALC_LANES];
+    uint8_t alpha_nr [CALC_LANES];
+    uint8_t alpha_s [CALC_LANES];
+    uint8_t alpha_c10 [CALC_LANES];
+    uint8_t alpha_k [CALC_LANES];
+    uint8_t beta_s [CALC_LANES];
+    uint8_t beta_ns [CALC_LANES];
+    uint8_t beta_q [CALC_LANES];
+    uint8_t beta_k [CALC_LANES];
+    uint8_t gamma_c [CALC_LANES];
+    uint8_t gamma_nc [CALC_LANES];
+    uint8_t gamma_nkey [CALC_LANES];
+    uint8_t wr [CALC_LANES];
+    uint8_t flags [CALC_LANES];
+} ucode_lanes_t;
+
+//
+// Put one micro-instruction into a lane.
+//
+static inline void ucode_put (ucode_lanes_t *u, unsigned l,
+    const plm_ucode_t *p)
+{
+    u->alpha_r[l] = p->alpha_r;
+    u->alpha_m[l] = p->alpha_m;
+    u->alpha_st[l] = p->alpha_st;
+    u->alpha_nr[l] = p->alpha_nr;
+    u->alpha_s[l] = p->alpha_s;
+    u->alpha_c10[l] = p->alpha_c10;
+    u->alpha_k[l] = p->alpha_k;
+    u->beta_s[l] = p->beta_s;
+    u->beta_ns[l] = p->beta_ns;
+    u->beta_q[l] = p->beta_q;
+    u->beta_k[l] = p->beta_k;
+    u->gamma_c[l] = p->gamma_c;
+    u->gamma_nc[l] = p->gamma_nc;
+    u->gamma_nkey[l] = p->gamma_nkey;
+    u->wr[l] = p->wr;
+    u->flags[l] = p->flags;
+}
+
+//
+// Load a PLM chip into a lane.
+//
+static void plm_lanes_load (plm_lanes_t *t, unsigned l, const plm_t *p)
+{
+    int i;
+
+    for (i=0; i<REG_NWORDS; i++) {
+        t->R[i][l] = nib_get (p->R, i);
+        t->M[i][l] = nib_get (p->M, i);
+        t->ST[i][l] = nib_get (p->ST, i);
+    }
+    for (i=0; i<14; i++)
+        t->show_dot[i][l] = p->show_dot[i];
+    t->input[l] = p->input;
+    t->output[l] = p->output;
+    t->S[l] = p->S;
+    t->Q[l] = p->Q;
+    t->carry[l] = p->carry;
+    t->keypad_event[l] = p->keypad_event;
+    t->keyb_x[l] = p->keyb_x;
+    t->keyb_y[l] = p->keyb_y;
+    t->dot[l] = p->dot;
+    t->enable_display[l] = p->enable_display;
+    t->command[l] = p->command;
+    t->scan[l] = (p->command & 0xfc0000) == 0;
+    t->wr_low[l] = (p->command >> 24) == 0;
+    t->useq[l] = p->useq;
+    t->rom = p->rom;
+}
+
+//
+// Store a lane into a PLM chip.
+//
+static void plm_lanes_store (const plm_lanes_t *t, unsigned l, plm_t *p)
+{
+    int i;
+
+    for (i=0; i<REG_NWORDS; i++) {
+        nib_set (p->R, i, t->R[i][l]);
+        nib_set (p->M, i, t->M[i][l]);
+        nib_set (p->ST, i, t->ST[i][l]);
+    }
+    for (i=0; i<14; i++)
+        p->show_dot[i] = t->show_dot[i][l];
+    p->input = t->input[l];
+    p->output = t->output[l];
+    p->S = t->S[l];
+    p->Q = t->Q[l];
+    p->carry = t->carry[l];
+    p->keypad_event = t->keypad_event[l];
+    p->keyb_x = t->keyb_x[l];
+    p->keyb_y = t->keyb_y[l];
+    p->dot = t->dot[l];
+    p->enable_display = t->enable_display[l];
+    p->command = t->command[l];
+    p->useq = t->useq[l];
+}
+
+static void fifo_lanes_load (fifo_lanes_t *t, unsigned l, const fifo_t *f)
+{
+    int i;
+
+    for (i=0; i<FIFO_NWORDS; i++)
+        t->data[i][l] = nib_get (f->data, i);
+    t->input[l] = f->input;
+    t->output[l] = f->output;
+}
+
+static void fifo_lanes_store (const fifo_lanes_t *t, unsigned l, fifo_t *f)
+{
+    int i;
+
+    for (i=0; i<FIFO_NWORDS; i++)
+        nib_set (f->data, i, t->data[i][l]);
+    f->input = t->input[l];
+    f->output = t->output[l];
+    f->cycle = t->cycle;
+}
+
+//
+// Simulate one cycle of the PLM chip in all lanes.
+//
+static void plm_lanes_step (plm_lanes_t *t, unsigned cycle)
+{
+    const plm_rom_t *rom = t->rom;
+    ucode_lanes_t u;
+    unsigned l;
+
+    /* D stage in range 0...13 */
+    unsigned d = cycle / 3;
+
+    /* Neighbour words, modulo REG_NWORDS. */
+    unsigned cycle_plus_1 = (cycle + 1) % REG_NWORDS;
+    unsigned cycle_plus_2 = (cycle + 2) % REG_NWORDS;
+    unsigned cycle_plus_3 = (cycle + 3) % REG_NWORDS;
+    unsigned cycle_minus_1 = (cycle - 1 + REG_NWORDS) % REG_NWORDS;
+    unsigned cycle_minus_2 = (cycle - 2 + REG_NWORDS) % REG_NWORDS;
+    unsigned wr_high = cycle >= 36;
+
+    /*
+     * Fetch program counter from the R register.
+     */
+    if (cycle == 0) {
+        for (l=0; l<CALC_LANES; l++) {
+            unsigned pc = t->R[36][l] + (t->R[39][l] << 4);
+            uint32_t command = pgm_read_dword_near(&rom->cmd_rom[pc]);
+
+            t->command[l] = command;
+            t->useq[l] = rom->useq[pc];
+            t->scan[l] = (command & 0xfc0000) == 0;
+            t->wr_low[l] = (command >> 24) == 0;
+            if (t->scan[l])
+                t->keypad_event[l] = 0;
+        }
+    }
+
+    /*
+     * Last third of the word may load a constant into R.
+     */
+    if (cycle == 36) {
+        for (l=0; l<CALC_LANES; l++) {
+            unsigned prog_index = (t->command[l] >> 16) & 0xff;
+            if (prog_index > 0x1f) {
+                t->R[37][l] = prog_index & 0xf;
+                t->R[40][l] = prog_index >> 4;
+            }
+        }
+    }
+
+    /*
+     * Gather micro-instructions of all lanes.
+     * Lanes in step with each other share one: broadcast it.
+     */
+    uint8_t inst_addr [CALC_LANES];
+    uint8_t diverged = 0;
+    for (l=0; l<CALC_LANES; l++) {
+        unsigned a = pgm_read_byte(&t->useq[l][cycle]);
+        if (a & PLM_USEQ_CARRY)
+            a = (a & ~PLM_USEQ_CARRY) + (t->carry[l] ^ 1);
+        inst_addr[l] = a;
+        diverged |= a ^ inst_addr[0];
+    }
+    if (! diverged) {
+        const plm_ucode_t *p = &rom->ucode[inst_addr[0]];
+        for (l=0; l<CALC_LANES; l++)
+            ucode_put (&u, l, p);
+    } else {
+        for (l=0; l<CALC_LANES; l++)
+            ucode_put (&u, l, &rom->ucode[inst_addr[l]]);
+    }
+
+    /*
+     * Execute them, with selects in place of branches.
+     * Rows touched in this cycle never overlap, hence restrict.
+     */
+    uint8_t *restrict R = t->R[cycle];
+    uint8_t *restrict R_plus_3 = t->R[cycle_plus_3];
+    uint8_t *restrict R_minus_1 = t->R[cycle_minus_1];
+    uint8_t *restrict R_minus_2 = t->R[cycle_minus_2];
+    uint8_t *restrict M = t->M[cycle];
+    uint8_t *restrict ST = t->ST[cycle];
+    uint8_t *restrict ST_plus_1 = t->ST[cycle_plus_1];
+    uint8_t *restrict ST_plus_2 = t->ST[cycle_plus_2];
+    uint8_t *restrict show_dot = t->show_dot[d];
+    uint8_t *restrict out = t->output;
+    uint8_t *restrict S_reg = t->S;
+    uint8_t *restrict Q_reg = t->Q;
+    uint8_t *restrict carry_reg = t->carry;
+    uint8_t *restrict kev_reg = t->keypad_event;
+    uint8_t *restrict dot_reg = t->dot;
+    uint8_t *restrict enable_display = t->enable_display;
+    const uint8_t *restrict in = t->input;
+    const uint8_t *restrict keyb_x = t->keyb_x;
+    const uint8_t *restrict keyb_y = t->keyb_y;
+    const uint8_t *restrict scan_reg = t->scan;
+    const uint8_t *restrict wr_low = t->wr_low;
+
+#ifdef __GNUC__
+#pragma GCC ivdep
+#endif
+    for (l=0; l<CALC_LANES; l++) {
+        uint8_t flags = u.flags[l];
+        uint8_t op_r = PLM_WR_R(u.wr[l]);
+        uint8_t op_s = PLM_WR_S(u.wr[l]);
+        uint8_t carry = carry_reg[l];
+        uint8_t kev = kev_reg[l];
+        uint8_t S = S_reg[l];
+        uint8_t Q = Q_reg[l];
+        uint8_t r = R[l];
+        uint8_t ky = keyb_y[l];
+        uint8_t scan = scan_reg[l];
+        uint8_t key_down = ky != 0;
+        uint8_t key_here = (keyb_x[l] == d + 1) & key_down;
+        uint8_t key_other = (keyb_x[l] != d + 1) & key_down;
+
+        Q = ((flags & PLM_U_KEYPAD) && key_other) ? ky : Q;
+
+        /* Alpha. */
+        uint8_t alpha = (r & u.alpha_r[l]) | ((r ^ 0xf) & u.alpha_nr[l]) |
+            (M[l] & u.alpha_m[l]) | (ST[l] & u.alpha_st[l]) |
+            (S & u.alpha_s[l]) | u.alpha_k[l] | (carry ? 0 : u.alpha_c10[l]);
+
+        /* Beta. */
+        uint8_t beta = (S & u.beta_s[l]) | ((S ^ 0xf) & u.beta_ns[l]) |
+            (Q & u.beta_q[l]) | u.beta_k[l];
+
+        /* Poll keypad. */
+        Q = (scan && key_here) ? ky : Q;
+        kev = scan ? (key_here ? 1 : kev) : (key_down ? kev : 0);
+        enable_display[l] |= scan;
+        dot_reg[l] = (scan && carry && d < 12) ? d : dot_reg[l];
+        show_dot[l] = scan ? carry : show_dot[l];
+
+        /* Gamma. */
+        uint8_t gamma = (carry & u.gamma_c[l]) | ((carry ^ 1) & u.gamma_nc[l]) |
+            ((kev ^ 1) & u.gamma_nkey[l]);
+
+        /* Sum and carry. */
+        uint8_t sum = alpha + beta + gamma;
+        carry = (flags & PLM_U_CARRY_SUM) ? (sum >> 4) & 1 : carry;
+        sum &= 0xf;
+
+        /* R register: ops 1..7 as in UCMD_R_*, 0 keeps it. */
+        uint8_t wr = wr_low[l] | wr_high;
+        uint8_t val = op_r == (UCMD_R_R3 >> 15) ? R_plus_3[l] : 0;
+        val |= (op_r == (UCMD_R_SUM >> 15) || op_r >= (UCMD_R_RSSUM >> 15)) &&
+               op_r != (UCMD_R_RS >> 15) ? sum : 0;
+        val |= (op_r == (UCMD_R_S >> 15) || op_r == (UCMD_R_RSSUM >> 15) ||
+               op_r == (UCMD_R_SSUM >> 15) || op_r == (UCMD_R_RS >> 15)) ? S : 0;
+        val |= (op_r == 0 || op_r == (UCMD_R_RSSUM >> 15) ||
+               op_r >= (UCMD_R_RS >> 15)) ? r : 0;
+        R[l] = wr ? val : r;
+        R_minus_1[l] = (wr && (flags & PLM_U_R1_SUM)) ? sum : R_minus_1[l];
+        R_minus_2[l] = (wr && (flags & PLM_U_R2_SUM)) ? sum : R_minus_2[l];
+
+        /* M register. */
+        uint8_t m = (flags & PLM_U_M_S) ? S : M[l];
+
+        /* S register: Q, sum or both, see UCMD_S_*. */
+        S = op_s ? ((op_s & 1 ? Q : 0) | (op_s & 2 ? sum : 0)) : S;
+
+        /* Q register. */
+        Q = (flags & PLM_U_Q_SUM) ? sum : Q;
+
+        /* ST register: shift in sum, then rotate. */
+        uint8_t st0 = ST[l];
+        uint8_t st1 = ST_plus_1[l];
+        uint8_t st2 = ST_plus_2[l];
+        uint8_t push = flags & PLM_U_ST_SUM;
+        uint8_t a0 = push ? sum : st0;
+        uint8_t a1 = push ? st0 : st1;
+        uint8_t a2 = push ? st1 : st2;
+        uint8_t rot = flags & PLM_U_ST_ROT;
+        ST[l] = rot ? a1 : a0;
+        ST_plus_1[l] = rot ? a2 : a1;
+        ST_plus_2[l] = rot ? a0 : a2;
+
+        /* Store input, pass output. */
+        out[l] = m & 0xf;
+        M[l] = in[l];
+
+        S_reg[l] = S;
+        Q_reg[l] = Q;
+        carry_reg[l] = carry;
+        kev_reg[l] = kev;
+    }
+}
+
+//
+// Simulate one cycle of the FIFO chip in all lanes.
+//
+static void fifo_lanes_step (fifo_lanes_t *t)
+{
+    uint8_t *data = t->data[t->cycle];
+    unsigned l;
+
+    for (l=0; l<CALC_LANES; l++) {
+        t->output[l] = data[l];
+        data[l] = t->input[l];
+    }
+    t->cycle++;
+    if (t->cycle >= FIFO_NWORDS)
+        t->cycle = 0;
+}
+
+//
+// Pass one chip's output to the next chip's input in all lanes.
+//
+static void wire (uint8_t dst[], const uint8_t src[])
+{
+    unsigned l;
+
+    for (l=0; l<CALC_LANES; l++)
+        dst[l] = src[l];
+}
+
+void calc_lanes_init (calc_lanes_t *g)
+{
+    calc_ctx_t c;
+    unsigned l;
+
+    calc_ctx_init (&c);
+    for (l=0; l<CALC_LANES; l++) {
+        calc_lanes_load (g, l, &c);
+        g->key[l] = 0;
+        g->rgd[l] = MODE_RADIANS;
+    }
+}
+
+int calc_lanes_load (calc_lanes_t *g, unsigned l, const calc_ctx_t *c)
+{
+    if (l == 0)
+        g->fifo1.cycle = g->fifo2.cycle = c->fifo1.cycle;
+    else if (c->fifo1.cycle != g->fifo1.cycle)
+        return -1;
+
+    plm_lanes_load (&g->ik1302, l, &c->ik1302);
+    plm_lanes_load (&g->ik1303, l, &c->ik1303);
+#ifndef MK_54
+    plm_lanes_load (&g->ik1306, l, &c->ik1306);
+#endif
+    fifo_lanes_load (&g->fifo1, l, &c->fifo1);
+    fifo_lanes_load (&g->fifo2, l, &c->fifo2);
+    return 0;
+}
+
+void calc_lanes_store (const calc_lanes_t *g, unsigned l, calc_ctx_t *c)
+{
+    plm_lanes_store (&g->ik1302, l, &c->ik1302);
+    plm_lanes_store (&g->ik1303, l, &c->ik1303);
+#ifndef MK_54
+    plm_lanes_store (&g->ik1306, l, &c->ik1306);
+#endif
+    fifo_lanes_store (&g->fifo1, l, &c->fifo1);
+    fifo_lanes_store (&g->fifo2, l, &c->fifo2);
+    calc_ctx_changed (c);
+}
+
+uint32_t calc_lanes_step (calc_lanes_t *g)
+{
+    uint32_t running = 0;
+    unsigned k, l, cycle;
+
+    for (l=0; l<CALC_LANES; l++) {
+        g->ik1302.keyb_x[l] = g->key[l] >> 4;
+        g->ik1302.keyb_y[l] = g->key[l] & 0xf;
+        g->ik1303.keyb_x[l] = g->rgd[l];
+        g->ik1303.keyb_y[l] = 1;
+    }
+
+    for (k=0; k<560; k++) {
+        for (cycle=0; cycle<REG_NWORDS; cycle++) {
+            wire (g->ik1302.input, g->fifo2.output);
+            plm_lanes_step (&g->ik1302, cycle);
+            wire (g->ik1303.input, g->ik1302.output);
+            plm_lanes_step (&g->ik1303, cycle);
+#ifdef MK_54
+            wire (g->fifo1.input, g->ik1303.output);
+#else
+            wire (g->ik1306.input, g->ik1303.output);
+            plm_lanes_step (&g->ik1306, cycle);
+            wire (g->fifo1.input, g->ik1306.output);
+#endif
+            fifo_lanes_step (&g->fifo1);
+            wire (g->fifo2.input, g->fifo1.output);
+            fifo_lanes_step (&g->fifo2);
+            wire (g->ik1302.M[cycle], g->fifo2.output);
+        }
+
+        // Digit strobe of calc_ctx_step() clears the display flag
+        // in manual mode.
+        if (k % 14 < 12) {
+            for (l=0; l<CALC_LANES; l++) {
+                if (g->ik1302.dot[l] != 11)
+                    g->ik1302.enable_display[l] = 0;
+            }
+        }
+    }
+
+    for (l=0; l<CALC_LANES; l++) {
+        if (g->ik1302.dot[l] == 11)
+            running |= 1UL << l;
+    }
+    return running;
+}
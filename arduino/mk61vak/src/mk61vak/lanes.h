@@ -0,0 +1,89 @@
+/*
+ * Lane-parallel calculator engine.
+ *
+ * Runs CALC_LANES calculators in lockstep, structure-of-arrays:
+ * every register word holds one byte per lane, so each step of
+ * the chip ring is a loop over lanes the compiler can vectorize.
+ * Lanes may execute different commands; micro-instructions are
+ * gathered per lane and applied with masks, bit-exact with plm_step.
+ */
+#pragma once
+
+#include "calc.h"
+
+#ifndef CALC_LANES
+#define CALC_LANES  16                  // Calculators per group, 1..32
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint8_t R [REG_NWORDS][CALC_LANES];
+    uint8_t M [REG_NWORDS][CALC_LANES];
+    uint8_t ST [REG_NWORDS][CALC_LANES];
+    uint8_t input [CALC_LANES];
+    uint8_t output [CALC_LANES];
+    uint8_t S [CALC_LANES];
+    uint8_t Q [CALC_LANES];
+    uint8_t carry [CALC_LANES];
+    uint8_t keypad_event [CALC_LANES];
+    uint8_t keyb_x [CALC_LANES];
+    uint8_t keyb_y [CALC_LANES];
+    uint8_t dot [CALC_LANES];
+    uint8_t enable_display [CALC_LANES];
+    uint8_t show_dot [14][CALC_LANES];
+    uint8_t scan [CALC_LANES];          // Command polls keypad and display
+    uint8_t wr_low [CALC_LANES];        // R written in cycles 0...35 too
+    uint32_t command [CALC_LANES];
+    const uint8_t *useq [CALC_LANES];
+    const plm_rom_t *rom;
+} plm_lanes_t;
+
+typedef struct {
+    uint8_t data [FIFO_NWORDS][CALC_LANES];
+    uint8_t input [CALC_LANES];
+    uint8_t output [CALC_LANES];
+    uint16_t cycle;                     // Shared by all lanes
+} fifo_lanes_t;
+
+typedef struct {
+    plm_lanes_t ik1302;
+    plm_lanes_t ik1303;
+#ifndef MK_54
+    plm_lanes_t ik1306;
+#endif
+    fifo_lanes_t fifo1;
+    fifo_lanes_t fifo2;
+    uint8_t key [CALC_LANES];           // Keycode held during the next step
+    uint8_t rgd [CALC_LANES];           // MODE_* switch position
+} calc_lanes_t;
+
+//
+// Initialize all lanes to a calculator just after calc_ctx_init().
+//
+void calc_lanes_init (calc_lanes_t *g);
+
+//
+// Copy a context into a lane.
+// All lanes must share the FIFO phase: return -1 if the context
+// is at a different one, 0 on success.
+//
+int calc_lanes_load (calc_lanes_t *g, unsigned lane, const calc_ctx_t *c);
+
+//
+// Copy a lane back into a context. Callbacks of the context are kept.
+//
+void calc_lanes_store (const calc_lanes_t *g, unsigned lane, calc_ctx_t *c);
+
+//
+// Simulate one cycle of all calculators, like calc_ctx_step()
+// with key[] and rgd[] held for the whole step and no display output.
+// Return a bit mask of lanes running a user program.
+//
+uint32_t calc_lanes_step (calc_lanes_t *g);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,3854 @@
+/*
+ * Micro-address of every instruction and cycle of the ROM sets.
+ * Generated by tools/useqgen.c, do not edit.
+ */
+static const uint8_t ik1302_useq_rom[CMD_NWORDS][REG_NWORDS] PROGMEM = {
+    {
+        0x0e, 0x03, 0x00, 0x2b, 0x2f, 0x0d, 0x2b, 0x2f, 0x0d, 0x2b, 0x2f, 0x0d, 0x2b, 0x2f,
+        0x0d, 0x2b, 0x2f, 0x0d, 0x2b, 0x2f, 0x0d, 0x2b, 0x2f, 0x0d, 0x12, 0x03, 0x04, 0x0e,
+        0x03, 0x00, 0x2b, 0x2f, 0x0d, 0x12, 0x03, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
+        0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x02, 0x24, 0x1e, 0x00,
+        0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x35, 0x03, 0x07, 0x0c, 0x1e, 0x1a,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1c, 0x03, 0x1e, 0x15, 0x02, 0x0c, 0x00, 0x35, 0x03, 0x07, 0x0c, 0x1e, 0x1a,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+        0x18, 0x09, 0x16, 0x18, 0x09, 0x16, 0x18, 0x24, 0x00, 0x03, 0x0e, 0x1e, 0x33, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0b, 0x0d, 0x0c, 0x03, 0x0e,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+        0x1e, 0x0f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x3b, 0x04, 0x2f, 0x37, 0x12, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x09, 0x15, 0x18, 0x00, 0x35, 0x03, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x24, 0x1e, 0x1a, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d,
+        0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x32, 0x01, 0x1d, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08,
+        0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x32, 0x32,
+        0x08, 0x23, 0x32, 0x08, 0x0f, 0x23, 0x23, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+        0x03, 0x0e, 0x2b, 0x3a, 0x09, 0x12, 0x1e, 0x33, 0x00, 0x00, 0x00, 0x10, 0x03, 0x1d,
+    },
+    {
+        0x09, 0x0c, 0x2f, 0x09, 0x03, 0x00, 0x09, 0x03, 0x00, 0x09, 0x03, 0x00, 0x09, 0x03,
+        0x00, 0x09, 0x03, 0x00, 0x09, 0x03, 0x00, 0x09, 0x03, 0x00, 0x24, 0x0c, 0x0f, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03,
+        0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00,
+        0x00, 0x00, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00, 0x00, 0x00, 0x10, 0x03, 0x1d,
+    },
+    {
+        0x00, 0x00, 0x00, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03,
+        0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00,
+        0x00, 0x00, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00, 0x00, 0x00, 0x10, 0x03, 0x1d,
+    },
+    {
+        0x00, 0x00, 0x00, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03,
+        0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00,
+        0x00, 0x00, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00, 0x00, 0x00, 0x10, 0x03, 0x1d,
+    },
+    {
+        0x00, 0x00, 0x00, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03,
+        0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00,
+        0x00, 0x00, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00, 0x00, 0x00, 0x10, 0x03, 0x1d,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x15, 0x12,
+        0x04, 0x01, 0x0f, 0x07, 0x1e, 0x0f, 0x00, 0x01, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x32, 0x01, 0x1d, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08,
+        0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x32, 0x32,
+        0x08, 0x23, 0x32, 0x08, 0x0f, 0x23, 0x23, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x04, 0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32,
+        0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x0c, 0x03,
+        0x32, 0x00, 0x2b, 0x14, 0x00, 0x00, 0x08, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x04, 0x01, 0x0f, 0x07, 0x1e, 0x0f, 0x00, 0x01, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13,
+        0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x01,
+        0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x2c, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00,
+        0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x09, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x0c, 0x0d, 0x01, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0f, 0x10, 0x03, 0x00, 0x1c, 0x03, 0x0f, 0x1d, 0x1c, 0x0c, 0x2f, 0x09, 0x1e, 0x34,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x0b, 0x00, 0x07,
+        0x0b, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x0b, 0x22, 0x03, 0x04, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x0c, 0x2f, 0x09, 0x1e, 0x34,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0f, 0x10, 0x03, 0x00, 0x1c, 0x03, 0x0f, 0x1d, 0x06, 0x0a, 0x0d, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0f, 0x10, 0x03, 0x00, 0x1c, 0x03, 0x0f, 0x1d, 0x1c, 0x0c, 0x0d, 0x01, 0x00, 0x00,
+    },
+    {
+        0x07, 0x0b, 0x0f, 0x07, 0x0c, 0x1e, 0x07, 0x0c, 0x1e, 0x07, 0x0c, 0x1e, 0x07, 0x0c,
+        0x1e, 0x07, 0x0c, 0x1e, 0x07, 0x0c, 0x1e, 0x07, 0x0c, 0x1e, 0x1a, 0x0f, 0x00, 0x24,
+        0x0c, 0x1e, 0x0f, 0x00, 0x07, 0x03, 0x0f, 0x00, 0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e,
+    },
+    {
+        0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03,
+        0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x0a, 0x0f, 0x06, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e,
+    },
+    {
+        0x2c, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00,
+        0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x09, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x0d, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x15, 0x23, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    },
+    {
+        0x32, 0x09, 0x0f, 0x32, 0x07, 0x0c, 0x32, 0x07, 0x0c, 0x32, 0x07, 0x0c, 0x32, 0x07,
+        0x0c, 0x32, 0x07, 0x0c, 0x32, 0x07, 0x0c, 0x32, 0x07, 0x0c, 0x0c, 0x1a, 0x0f, 0x15,
+        0x18, 0x09, 0x16, 0x18, 0x09, 0x16, 0x18, 0x24, 0x06, 0x03, 0x0e, 0x2b, 0x3a, 0x09,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+        0x1e, 0x1a, 0x23, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x06, 0x18, 0x00, 0x17, 0x18, 0x00, 0x17, 0x18, 0x00, 0x17, 0x18, 0x00, 0x17, 0x18,
+        0x00, 0x17, 0x18, 0x00, 0x17, 0x18, 0x00, 0x17, 0x18, 0x00, 0x17, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x00, 0x01, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x09, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x15, 0x18, 0x09, 0x16, 0x18, 0x09, 0x16, 0x18, 0x09, 0x16, 0x18, 0x09, 0x16, 0x18,
+        0x09, 0x16, 0x18, 0x09, 0x16, 0x18, 0x09, 0x16, 0x18, 0x09, 0x16, 0x18, 0x24, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x1c, 0x0c, 0x0d, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+        0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x24, 0x0f, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00,
+        0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32,
+        0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1c, 0x0c, 0x0d, 0x01, 0x00, 0x00,
+    },
+    {
+        0x1e, 0x02, 0x1d, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c,
+        0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c, 0x0f, 0x26, 0x07, 0x22, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03,
+        0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x0a, 0x0f, 0x06, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x0e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+        0x1e, 0x0f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x1c, 0x0c, 0x0d, 0x01, 0x00, 0x00,
+    },
+    {
+        0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03,
+        0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x0a, 0x0f, 0x06, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x34, 0x0d, 0x24, 0x1e, 0x1a,
+    },
+    {
+        0x06, 0x0a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0f, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d,
+        0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d, 0x01, 0x09, 0x1e, 0x2b, 0x1a,
+        0x30, 0x0d, 0x00, 0x30, 0x0d, 0x00, 0x30, 0x0d, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00,
+        0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32,
+        0x00, 0x00, 0x32, 0x00, 0x00, 0x08, 0x36, 0x00, 0x35, 0x03, 0x07, 0x0c, 0x1e, 0x1a,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x15, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31,
+        0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x36, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x0e, 0x1e, 0x15, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00,
+        0x0e, 0x08, 0x0e, 0x1d, 0x23, 0x1e, 0x3a, 0x3a, 0x10, 0x03, 0x1c, 0x0b, 0x07, 0x0c,
+    },
+    {
+        0x0e, 0x0f, 0x20, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x05, 0x00,
+        0x07, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x12, 0x0e, 0x08, 0x01,
+        0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x36, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x1d, 0x04, 0x15, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x3a, 0x00, 0x00,
+        0x3a, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x3a, 0x00,
+        0x00, 0x3a, 0x00, 0x0d, 0x0e, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0x1d,
+    },
+    {
+        0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03,
+        0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x0a, 0x0f, 0x06, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x0e, 0xc2, 0x03, 0x01,
+    },
+    {
+        0x06, 0x18, 0x00, 0x17, 0x18, 0x00, 0x17, 0x18, 0x00, 0x17, 0x18, 0x00, 0x17, 0x18,
+        0x00, 0x17, 0x18, 0x00, 0x17, 0x18, 0x00, 0x17, 0x18, 0x00, 0x17, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0xbe, 0x00, 0x0e, 0xc2, 0x03, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x03, 0x00, 0x2b, 0x2f, 0x0d, 0x12, 0x03, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x15, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00,
+        0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x0e,
+        0x03, 0x00, 0x2b, 0x2f, 0x0d, 0x12, 0x03, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03,
+        0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00,
+        0x00, 0x00, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00, 0x00, 0x00, 0x10, 0x03, 0x1d,
+    },
+    {
+        0x00, 0x00, 0x00, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03,
+        0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00,
+        0x00, 0x00, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00, 0x00, 0x00, 0x10, 0x03, 0x1d,
+    },
+    {
+        0x00, 0x00, 0x00, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03,
+        0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00,
+        0x00, 0x00, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00, 0x00, 0x00, 0x10, 0x03, 0x1d,
+    },
+    {
+        0x00, 0x00, 0x00, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03,
+        0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00,
+        0x00, 0x00, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00, 0x00, 0x00, 0x10, 0x03, 0x1d,
+    },
+    {
+        0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13,
+        0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x01,
+        0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00,
+        0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x37,
+        0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x2c, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00,
+        0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x09, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x01, 0x12, 0x00, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00,
+        0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x0a, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x1e, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12,
+        0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x1a, 0x1e,
+        0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x1a, 0x1c, 0x0c, 0x2f, 0x09, 0x1e, 0x34,
+    },
+    {
+        0x01, 0x12, 0x00, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00,
+        0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x0a, 0x00, 0x00, 0x06,
+        0x18, 0x00, 0x17, 0x18, 0x00, 0x17, 0x18, 0x00, 0x06, 0x0a, 0x0d, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x0f, 0x10, 0x03, 0x00, 0x1c, 0x03, 0x0f, 0x1d, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x0e, 0x03, 0x09, 0x0c, 0x1b, 0x1e, 0x0c, 0x1b, 0x1e, 0x0c, 0x1b, 0x1e, 0x0c, 0x1b,
+        0x1e, 0x0c, 0x1b, 0x1e, 0x0c, 0x1b, 0x1e, 0x0c, 0x1b, 0x1e, 0x0f, 0x1b, 0x08, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00,
+        0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e,
+        0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x1c, 0x0c, 0x0d, 0x01, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+        0x03, 0x07, 0x0c, 0x1e, 0x1a, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13,
+        0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x01,
+        0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+        0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x03, 0x00, 0x09, 0x09,
+        0x1e, 0x0f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+        0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x03, 0x00, 0x09, 0x09,
+        0x1e, 0x0f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x15, 0x09,
+        0x1e, 0x0f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x1c, 0x0c, 0x0d, 0x01, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+        0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x03, 0x00, 0x09, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0x2b, 0x23, 0x04, 0x08, 0x08, 0x00, 0x08, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x1e, 0x1a, 0x23, 0x1d, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+        0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x03, 0x00, 0x09, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x0c, 0x2f, 0x09, 0x1e, 0x34,
+    },
+    {
+        0x24, 0x0c, 0x1e, 0x0f, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x0f, 0x00,
+        0x07, 0x0f, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x03, 0x0f, 0x00, 0x0e,
+        0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+        0x04, 0x00, 0x00, 0x00, 0x12, 0x09, 0x0c, 0x12, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+        0x0b, 0x0d, 0x0c, 0x03, 0x0e, 0x1e, 0x3a, 0x2b, 0x00, 0x00, 0x00, 0x10, 0x03, 0x1d,
+    },
+    {
+        0x1d, 0x04, 0x08, 0x36, 0x00, 0x08, 0x36, 0x00, 0x08, 0x36, 0x00, 0x08, 0x36, 0x00,
+        0x08, 0x36, 0x00, 0x08, 0x36, 0x00, 0x08, 0x36, 0x00, 0x08, 0x12, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x09, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x03, 0x00, 0x2b, 0x2f, 0x0d, 0x12, 0x03, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03,
+        0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x10, 0x03, 0x1d, 0x00, 0x07, 0x1e, 0x00,
+        0x23, 0x1a, 0x07, 0x1e, 0x0c, 0x0f, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0xbe, 0x00, 0x0e, 0xc2, 0x03, 0x01, 0xc2, 0x03, 0x01, 0xc2, 0x03, 0x01, 0xc2, 0x03,
+        0x01, 0xc2, 0x03, 0x01, 0xc2, 0x03, 0x01, 0xc2, 0x03, 0x01, 0x00, 0x00, 0x0e, 0x00,
+        0x00, 0x00, 0x0a, 0x1a, 0x18, 0x00, 0x17, 0x03, 0x06, 0x0a, 0x0d, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x39, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25,
+        0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x03, 0x07, 0x0f, 0x26,
+        0x12, 0x15, 0x03, 0x12, 0x04, 0x24, 0x2f, 0x0f, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x15, 0x00,
+        0x00, 0x01, 0x0f, 0x07, 0x0b, 0x0f, 0x25, 0x0f, 0x23, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    },
+    {
+        0x24, 0x1e, 0x1a, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d,
+        0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x24, 0x0c, 0x1e, 0x0f, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x0f, 0x00,
+        0x07, 0x0f, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x03, 0x0f, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0e, 0x2b, 0x3a, 0x09,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x15, 0x00,
+        0x00, 0x2b, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x23, 0x23, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    },
+    {
+        0x24, 0x0c, 0x1e, 0x0f, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x0f, 0x00,
+        0x07, 0x0f, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x03, 0x0f, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x2b, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x23, 0x06, 0x03, 0x0e, 0x2b, 0x3a, 0x09,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x2b, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x23, 0x23, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    },
+    {
+        0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00,
+        0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x2b, 0x00, 0x32,
+        0x00, 0x00, 0x32, 0x27, 0x36, 0x08, 0x09, 0x0c, 0xbe, 0x07, 0x10, 0xc2, 0x03, 0x00,
+    },
+    {
+        0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00,
+        0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32,
+        0x09, 0x0f, 0x32, 0x07, 0x0c, 0x0c, 0x1a, 0x0f, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x04, 0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32,
+        0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x0c, 0x03,
+        0x32, 0x00, 0x2b, 0x14, 0x00, 0x00, 0x08, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+        0x0b, 0x1a, 0x1d, 0x28, 0x00, 0x0e, 0x28, 0x08, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+        0x1e, 0x1a, 0x18, 0x1d, 0x17, 0x03, 0x0f, 0xbe, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x0f, 0x10, 0x03, 0x00, 0x1c, 0x03, 0x0f, 0x1d, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+        0x1e, 0x10, 0x0f, 0x09, 0x32, 0x1e, 0x0f, 0x08, 0x3b, 0x04, 0x2f, 0x37, 0x12, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+        0x1e, 0x0f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x1c, 0x0c, 0x2f, 0x09, 0x1e, 0x34,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+        0x03, 0x1c, 0x0b, 0x07, 0x0c, 0x1e, 0x00, 0x00, 0xbe, 0x07, 0x10, 0xc2, 0x03, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1c, 0x03, 0x1e, 0x15, 0x02, 0x0c, 0x00, 0xbe, 0x09, 0x1e, 0xc2, 0x03, 0x07,
+    },
+    {
+        0x04, 0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32,
+        0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x0c, 0x0a,
+        0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x04, 0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32,
+        0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x0c, 0x0a,
+        0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x23, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    },
+    {
+        0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03,
+        0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x0a, 0x0f, 0x06, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x12, 0x1b, 0x0e, 0x0f, 0x1b, 0x0e, 0x0f, 0x1b, 0x0e, 0x0f, 0x1b, 0x0e, 0x0f, 0x1b,
+        0x0e, 0x0f, 0x1b, 0x0e, 0x0f, 0x1b, 0x0e, 0x0f, 0x1b, 0x0e, 0x23, 0x2b, 0x0a, 0x00,
+        0x00, 0x00, 0x0a, 0x1a, 0x18, 0x00, 0x17, 0x03, 0x1c, 0x0c, 0x2f, 0x09, 0x1e, 0x34,
+    },
+    {
+        0x04, 0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32,
+        0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x0c, 0x03,
+        0x32, 0x00, 0x2b, 0x14, 0x00, 0x00, 0x08, 0x00, 0x1c, 0x0c, 0x2f, 0x09, 0x1e, 0x34,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+        0x0b, 0x0f, 0x10, 0x03, 0x08, 0x24, 0x03, 0x23, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+        0x0b, 0x0f, 0x10, 0x03, 0x08, 0x24, 0x03, 0x23, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x00, 0x00, 0x0a, 0x1a, 0x18, 0x00, 0x17, 0x03, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2,
+        0x33, 0x0d, 0x01, 0x08, 0x00, 0x01, 0x08, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x14,
+        0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00,
+        0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x12,
+        0x04, 0x01, 0x0f, 0x07, 0x1e, 0x0f, 0x00, 0x01, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x0e, 0x08, 0x0e, 0x1d, 0x23, 0x0e, 0x1d, 0x23, 0x0e, 0x1d, 0x23, 0x0e, 0x1d,
+        0x23, 0x0e, 0x1d, 0x23, 0x0e, 0x1d, 0x23, 0x0e, 0x1d, 0x23, 0x1e, 0x3a, 0x3a, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x39, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25,
+        0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x03, 0x07, 0x0f, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x06, 0x0a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0f, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x39, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25,
+        0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x03, 0x07, 0x0f, 0x1e,
+        0x00, 0x10, 0x0f, 0x07, 0x0b, 0x34, 0x0f, 0x1d, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x0f, 0x10, 0x03, 0x00, 0x1c, 0x03, 0x0f, 0x1d, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x0f, 0x04, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00,
+        0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x09, 0x0c, 0x12, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    },
+    {
+        0x24, 0x1e, 0x1a, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d,
+        0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
+        0x00, 0x00, 0x00, 0x2f, 0x00, 0x2c, 0x00, 0x01, 0x00, 0x03, 0x0e, 0x1e, 0x33, 0x00,
+    },
+    {
+        0x00, 0x00, 0x39, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25,
+        0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x03, 0x07, 0x0f, 0x00,
+        0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
+        0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x1a, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x00, 0x01, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x15, 0x02,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x2f, 0x01, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x09, 0x0c, 0x2f, 0x09, 0x03, 0x00, 0x09, 0x03, 0x00, 0x09, 0x03, 0x00, 0x09, 0x03,
+        0x00, 0x09, 0x03, 0x00, 0x09, 0x03, 0x00, 0x09, 0x03, 0x00, 0x24, 0x0c, 0x0f, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x2f, 0x01, 0x02,
+        0x0d, 0x00, 0x01, 0x0f, 0x0d, 0x00, 0x0e, 0x1e, 0xbe, 0x00, 0x0e, 0xc2, 0x03, 0x01,
+    },
+    {
+        0x1e, 0x02, 0x1d, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c,
+        0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c, 0x0f, 0x26, 0x07, 0x22, 0x38,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x26, 0x06, 0x23, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x04, 0x01, 0x0f, 0x07, 0x1e, 0x0f, 0x00, 0x01, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x12, 0x04, 0x01, 0x0f, 0x07, 0x1e, 0x0f, 0x07, 0x1e, 0x0f, 0x07, 0x1e, 0x0f, 0x07,
+        0x1e, 0x0f, 0x07, 0x1e, 0x0f, 0x07, 0x1e, 0x0f, 0x07, 0x1e, 0x0f, 0x00, 0x01, 0x1c,
+        0x0c, 0x0d, 0x01, 0x00, 0x00, 0x03, 0x24, 0x0f, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00,
+        0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x04, 0x0c, 0x12, 0x1d,
+        0x23, 0x23, 0x09, 0x23, 0x0c, 0x03, 0x23, 0x23, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+        0x35, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x0f, 0x10, 0x03, 0x00, 0x1c, 0x03, 0x0f, 0x1d, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x39, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25,
+        0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x03, 0x07, 0x0f, 0x1e,
+        0x00, 0x10, 0x03, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2e,
+        0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc,
+        0x03, 0x00, 0x09, 0x34, 0x0e, 0x1e, 0x0c, 0x1e, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x0f, 0x10, 0x03, 0x00, 0x1c, 0x03, 0x0f, 0x1d, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x1e, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12,
+        0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x1a, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x04, 0x01, 0x0f, 0x07, 0x1e, 0x0f, 0x00, 0x01, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13,
+        0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x01,
+        0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01,
+        0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x01, 0x13, 0x00,
+        0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x01, 0x13, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00,
+        0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x37,
+        0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00,
+        0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e,
+        0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00,
+        0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e,
+        0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x1c, 0x0c, 0x2f, 0x09, 0x1e, 0x34,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f,
+        0x0e, 0x0d, 0x19, 0x03, 0x2f, 0x0e, 0x0d, 0x08, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x12, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00,
+        0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13,
+        0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x01,
+        0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x1c, 0x0c, 0x0d, 0x01, 0x00, 0x00,
+    },
+    {
+        0x11, 0x32, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+        0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x0e, 0x1a, 0x03,
+        0x32, 0x00, 0x2b, 0x14, 0x00, 0x00, 0x08, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01,
+        0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x01, 0x13, 0x00,
+        0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x01, 0x13, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
+        0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x02, 0x24, 0x1e, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x03, 0x07, 0x0c, 0x1e, 0x1a,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x07, 0x0a, 0x29, 0xc0, 0x33, 0x29, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x11, 0x00, 0x09, 0x16, 0x18, 0x09, 0x1e, 0xc2, 0x33, 0x0d, 0x01, 0x08, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe,
+        0x07, 0x10, 0xc2, 0x03, 0x00, 0x2c, 0x07, 0x1e, 0xbe, 0x00, 0x0e, 0xc2, 0x03, 0x01,
+    },
+    {
+        0x0e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x07,
+        0x0b, 0x0f, 0x07, 0x0c, 0x1e, 0x1a, 0x0f, 0x00, 0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+        0x1e, 0x0f, 0x01, 0x00, 0x08, 0x1c, 0x0a, 0x08, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x09, 0x1e, 0x0f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00,
+        0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
+        0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x02, 0x24, 0x1e, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x35, 0x03, 0x07, 0x0c, 0x1e, 0x1a,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x36, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+        0x00, 0x00, 0x00, 0x04, 0x32, 0x24, 0x0f, 0x23, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+        0x1e, 0x0f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x0f, 0x0e, 0x0d, 0x19, 0x03, 0x2f,
+    },
+    {
+        0x06, 0x0a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0f, 0x01,
+        0x12, 0x00, 0x08, 0x00, 0x32, 0x0a, 0x00, 0x00, 0x3b, 0x04, 0x2f, 0x37, 0x12, 0x00,
+    },
+    {
+        0x0e, 0x03, 0x09, 0x0c, 0x1b, 0x1e, 0x0c, 0x1b, 0x1e, 0x0c, 0x1b, 0x1e, 0x0c, 0x1b,
+        0x1e, 0x0c, 0x1b, 0x1e, 0x0c, 0x1b, 0x1e, 0x0c, 0x1b, 0x1e, 0x0f, 0x1b, 0x08, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31,
+        0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x36, 0x01,
+        0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x36, 0x35, 0x03, 0x07, 0x0c, 0x1e, 0x1a,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+        0x1e, 0x0f, 0x01, 0x00, 0x08, 0x1c, 0x0a, 0x08, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x0d, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1e, 0x1a, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2e,
+        0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x0e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x09,
+        0x1e, 0x0f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x00, 0x03, 0x0e, 0x1e, 0x33, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x0e, 0x0f, 0x20, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x05, 0x00,
+        0x07, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x12, 0x0e, 0x08, 0x03,
+        0x1e, 0x0f, 0x26, 0x0a, 0x02, 0x26, 0xc0, 0x08, 0x06, 0x03, 0x0e, 0x2b, 0x3a, 0x09,
+    },
+    {
+        0x00, 0x00, 0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d,
+        0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d, 0x01, 0x09, 0x1e, 0x2b, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x00, 0x01, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x09, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x35, 0x34, 0x0d, 0x24, 0x1e, 0x1a, 0x24, 0x1e, 0x1a, 0x24, 0x1e, 0x1a, 0x24, 0x1e,
+        0x1a, 0x24, 0x1e, 0x1a, 0x24, 0x1e, 0x1a, 0x24, 0x1e, 0x1a, 0x09, 0x0c, 0x0f, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x15, 0x00,
+        0x00, 0x2b, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x23, 0x23, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+        0x34, 0x0d, 0x24, 0x1e, 0x1a, 0x09, 0x0c, 0x0f, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x39, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25,
+        0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x03, 0x07, 0x0f, 0x1e,
+        0x00, 0x10, 0x0f, 0x24, 0x1e, 0x34, 0x1d, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x0f, 0x10, 0x03, 0x00, 0x1c, 0x03, 0x0f, 0x1d, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x0f, 0x10, 0x03, 0x00, 0x1c, 0x03, 0x0f, 0x1d, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+        0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x03, 0x00, 0x09, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x39, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25,
+        0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x04, 0x25, 0x08, 0x03, 0x07, 0x0f, 0x00,
+        0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+        0x0c, 0x2f, 0x09, 0x1e, 0x34, 0x0e, 0x1e, 0x0c, 0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e,
+    },
+    {
+        0x04, 0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32,
+        0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x0c, 0x0a,
+        0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d,
+        0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00,
+        0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x2e, 0x2d, 0x00, 0x2e, 0x2d, 0x00,
+    },
+    {
+        0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x23, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+        0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x03, 0x00, 0x09, 0x37,
+        0x00, 0x00, 0x37, 0x00, 0x00, 0x37, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x07, 0x0b, 0x0d, 0x0c, 0x03, 0x0e, 0x0c, 0x03, 0x0e, 0x0c, 0x03, 0x0e, 0x0c, 0x03,
+        0x0e, 0x0c, 0x03, 0x0e, 0x0c, 0x03, 0x0e, 0x0c, 0x03, 0x0e, 0x1e, 0x3a, 0x2b, 0xbc,
+        0x03, 0x00, 0x09, 0x34, 0x0e, 0x1e, 0x0c, 0x1e, 0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x04, 0x01, 0x0f, 0x07, 0x1e, 0x0f, 0x00, 0x01, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x0b, 0x00, 0x07,
+        0x0b, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x0b, 0x22, 0x03, 0x04, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x0e, 0x0f, 0x20, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x05, 0x00,
+        0x07, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x12, 0x0e, 0x08, 0x00,
+        0x01, 0x08, 0x04, 0x01, 0x08, 0x23, 0x01, 0x08, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x04, 0x0b, 0x08, 0x01, 0x10, 0x0d, 0x01, 0x10, 0x0d, 0x01, 0x10, 0x0d, 0x01, 0x10,
+        0x0d, 0x01, 0x10, 0x0d, 0x01, 0x10, 0x0d, 0x01, 0x10, 0x0d, 0x09, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0e, 0x2b, 0x3a, 0x09,
+    },
+    {
+        0x04, 0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32,
+        0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x0c, 0x03,
+        0x32, 0x00, 0x2b, 0x14, 0x00, 0x00, 0x08, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x0f, 0x10, 0x03, 0x00, 0x1c, 0x03, 0x0f, 0x1d, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x32, 0x01, 0x1d, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08,
+        0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x32, 0x32,
+        0x08, 0x23, 0x32, 0x08, 0x0f, 0x23, 0x23, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31,
+        0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x36, 0x01,
+        0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x36, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00,
+    },
+    {
+        0x0a, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30,
+        0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x0a,
+        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x2e, 0x30, 0x03, 0x2e, 0x30, 0x03,
+    },
+    {
+        0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01,
+        0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00,
+        0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x2e, 0x01, 0x31, 0x2e, 0x01, 0x31,
+    },
+    {
+        0x0e, 0x0f, 0x20, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x05, 0x00,
+        0x07, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x05, 0x00, 0x07, 0x12, 0x0e, 0x08, 0x00,
+        0x00, 0x1b, 0x00, 0x00, 0x1b, 0x1f, 0x0e, 0x1b, 0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x12, 0x00, 0x00, 0x12, 0x04, 0x0c, 0x12, 0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc,
+        0x03, 0x00, 0x09, 0x34, 0x0e, 0x1e, 0x0c, 0x1e, 0xbe, 0x00, 0x0e, 0xc2, 0x03, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x23, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x07, 0x0b, 0x22, 0x03, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x12, 0x2c, 0x00, 0x2b, 0x2a, 0x26, 0x2b, 0x2a, 0x26, 0x2b, 0x2a, 0x26, 0x2b, 0x2a,
+        0x26, 0x2b, 0x2a, 0x26, 0x2b, 0x2a, 0x26, 0x2b, 0x2a, 0x26, 0x0d, 0x07, 0x0f, 0x26,
+        0x12, 0x15, 0x03, 0x12, 0x04, 0x24, 0x2f, 0x0f, 0x00, 0x03, 0x0e, 0x1e, 0x33, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00,
+        0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x2b,
+        0x15, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x35, 0x0c, 0x2f, 0x0e, 0x03, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00,
+        0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x12,
+        0x04, 0x01, 0x0f, 0x07, 0x1e, 0x0f, 0x00, 0x01, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x0f, 0x1d, 0x2f, 0x0e, 0x03, 0x23, 0x0e, 0x03, 0x23, 0x0e, 0x03, 0x23, 0x0e, 0x03,
+        0x23, 0x0e, 0x03, 0x23, 0x0e, 0x03, 0x23, 0x0e, 0x03, 0x23, 0x07, 0x1e, 0x0d, 0x0f,
+        0x12, 0x00, 0x23, 0x24, 0x1e, 0x23, 0x0f, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+        0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x03, 0x00, 0x09, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00,
+        0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d,
+        0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x03, 0x00, 0x2b, 0x2f, 0x0d, 0x12, 0x03, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03,
+        0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x2b, 0x30,
+        0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x2b, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00,
+    },
+    {
+        0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00,
+        0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x2b, 0x00, 0x32,
+        0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x1d, 0x23, 0x23, 0x09, 0x23, 0x0c, 0x09, 0x23, 0x0c, 0x09, 0x23, 0x0c, 0x09, 0x23,
+        0x0c, 0x09, 0x23, 0x0c, 0x09, 0x23, 0x0c, 0x09, 0x23, 0x0c, 0x03, 0x23, 0x23, 0x00,
+        0x00, 0x12, 0x00, 0x00, 0x12, 0x04, 0x0c, 0x12, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00,
+        0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x2c,
+        0x18, 0x00, 0x2a, 0x18, 0x07, 0x0b, 0x03, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+        0x1a, 0x18, 0x19, 0x16, 0x18, 0x09, 0x16, 0x18, 0x1c, 0x0c, 0x0d, 0x01, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+        0x15, 0x18, 0x21, 0x16, 0x18, 0x00, 0x17, 0x18, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00,
+        0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x1b, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0b, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00,
+        0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32,
+        0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x03, 0x00, 0x23, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    },
+    {
+        0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x2f, 0x01, 0x12,
+        0x1b, 0x0e, 0x0f, 0x1b, 0x0e, 0x23, 0x2b, 0x0a, 0x23, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    },
+    {
+        0x1d, 0x23, 0x23, 0x09, 0x23, 0x0c, 0x09, 0x23, 0x0c, 0x09, 0x23, 0x0c, 0x09, 0x23,
+        0x0c, 0x09, 0x23, 0x0c, 0x09, 0x23, 0x0c, 0x09, 0x23, 0x0c, 0x03, 0x23, 0x23, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13,
+        0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x01,
+        0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x04, 0x01, 0x0f, 0x07, 0x1e, 0x0f, 0x00, 0x01, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08,
+        0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x04, 0x01,
+        0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
+        0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x02, 0x24, 0x1e, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x03, 0x07, 0x0c, 0x1e, 0x1a,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x2f, 0x00,
+    },
+    {
+        0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31,
+        0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x36, 0x01,
+        0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x36, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x00, 0x03, 0x0e, 0x1e, 0x33, 0x00,
+    },
+    {
+        0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31,
+        0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x36, 0x01,
+        0x31, 0x00, 0x01, 0x31, 0x00, 0x01, 0x31, 0x36, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00,
+    },
+    {
+        0x09, 0x0c, 0x15, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+        0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0xbc, 0x00, 0x00,
+        0x2c, 0x00, 0x00, 0x2a, 0x00, 0x09, 0x16, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x32, 0x01, 0x1d, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08,
+        0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x00, 0x32, 0x08, 0x32, 0x32,
+        0x08, 0x23, 0x32, 0x08, 0x0f, 0x23, 0x23, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13,
+        0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x01,
+        0x13, 0x00, 0x01, 0x13, 0x00, 0x01, 0x13, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc,
+        0x03, 0x00, 0x09, 0x34, 0x0e, 0x1e, 0x0c, 0x1e, 0x00, 0x03, 0x0e, 0x1e, 0x33, 0x00,
+    },
+    {
+        0x1a, 0x30, 0x0d, 0x00, 0x30, 0x0d, 0x00, 0x30, 0x0d, 0x00, 0x30, 0x0d, 0x00, 0x30,
+        0x0d, 0x00, 0x30, 0x0d, 0x00, 0x30, 0x0d, 0x00, 0x30, 0x0d, 0x00, 0x30, 0x0d, 0x1a,
+        0x30, 0x0d, 0x00, 0x30, 0x0d, 0x00, 0x30, 0x0d, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00,
+    },
+    {
+        0x12, 0x04, 0x01, 0x0f, 0x07, 0x1e, 0x0f, 0x07, 0x1e, 0x0f, 0x07, 0x1e, 0x0f, 0x07,
+        0x1e, 0x0f, 0x07, 0x1e, 0x0f, 0x07, 0x1e, 0x0f, 0x07, 0x1e, 0x0f, 0x00, 0x01, 0x12,
+        0x04, 0x01, 0x0f, 0x07, 0x1e, 0x0f, 0x00, 0x01, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x0e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00,
+        0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x17, 0x0d, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d,
+        0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d, 0x01, 0x0f, 0x0d, 0x01, 0x09, 0x1e, 0x2b, 0x0e,
+        0x03, 0x00, 0x2b, 0x2f, 0x0d, 0x12, 0x03, 0x04, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x35, 0x0c, 0x2f, 0x0e, 0x03, 0x01, 0x0e, 0x03, 0x01, 0x0e, 0x03, 0x01, 0x0e, 0x03,
+        0x01, 0x0e, 0x03, 0x01, 0x0e, 0x03, 0x01, 0x0e, 0x03, 0x01, 0x00, 0x00, 0x15, 0x0a,
+        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00,
+        0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x1b, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x23, 0x1a, 0x07, 0x1e, 0x0c, 0x07, 0x1e, 0x0c, 0x07, 0x1e, 0x0c, 0x07, 0x1e,
+        0x0c, 0x07, 0x1e, 0x0c, 0x07, 0x1e, 0x0c, 0x07, 0x1e, 0x0c, 0x0f, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x32, 0x00, 0x00, 0x00, 0x03,
+    },
+    {
+        0x32, 0x14, 0x00, 0x32, 0x32, 0x11, 0x32, 0x32, 0x11, 0x32, 0x32, 0x11, 0x32, 0x32,
+        0x11, 0x32, 0x32, 0x11, 0x32, 0x32, 0x11, 0x32, 0x32, 0x11, 0x00, 0x08, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x0d, 0x00, 0x00, 0x00,
+    },
+    {
+        0x32, 0x14, 0x00, 0x32, 0x32, 0x11, 0x32, 0x32, 0x11, 0x32, 0x32, 0x11, 0x32, 0x32,
+        0x11, 0x32, 0x32, 0x11, 0x32, 0x32, 0x11, 0x32, 0x32, 0x11, 0x00, 0x08, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+    {
+        0x0e, 0x1e, 0x15, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00,
+        0x0e, 0x08, 0x0e, 0x1d, 0x23, 0x1e, 0x3a, 0x3a, 0x10, 0x03, 0x1c, 0x0b, 0x07, 0x0c,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2,
+        0x33, 0x0d, 0x01, 0x08, 0x00, 0x01, 0x08, 0x04, 0x1c, 0x0c, 0x2f, 0x09, 0x1e, 0x34,
+    },
+    {
+        0x1d, 0x04, 0x15, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x3a, 0x00, 0x00,
+        0x3a, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x3a, 0x00,
+        0x00, 0x3a, 0x00, 0x0d, 0x0e, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0x1d,
+    },
+    {
+        0x24, 0x1e, 0x1a, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d,
+        0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x30,
+        0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x2b, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x03, 0x09, 0x0c, 0x1b, 0x1e, 0x0f, 0x1b, 0x08, 0x09, 0x0c, 0x2f, 0x09, 0x03, 0x00,
+    },
+    {
+        0x11, 0x32, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+        0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x0e, 0x1a, 0x00,
+        0x00, 0x01, 0x0f, 0x0d, 0x01, 0x09, 0x1e, 0x2b, 0xbc, 0x03, 0x00, 0x09, 0x34, 0x0e,
+    },
+    {
+        0x14, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00,
+        0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x14,
+        0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x06, 0x0a, 0x0d, 0x00, 0x00, 0x00,
+    },
+    {
+        0xbe, 0x00, 0x00, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03,
+        0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x1c, 0x03, 0x0e, 0x0a, 0x0f, 0x06, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0xbc, 0x2f, 0x37, 0xbc, 0x01,
+    },
+};
+
+static const uint8_t ik1303_useq_rom[CMD_NWORDS][REG_NWORDS] PROGMEM = {
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x12, 0x14, 0x06, 0x12, 0x02, 0x00, 0x12, 0x02, 0x00, 0x12, 0x02, 0x00, 0x12, 0x02,
+        0x00, 0x12, 0x02, 0x00, 0x12, 0x02, 0x00, 0x12, 0x02, 0x00, 0x0a, 0x02, 0x00, 0x0a,
+        0x24, 0x0c, 0x00, 0x0a, 0x21, 0x06, 0x20, 0x18, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x08, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00,
+        0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x37, 0x08, 0x1d, 0x18,
+        0x07, 0x06, 0x35, 0x10, 0x34, 0x05, 0x09, 0x24, 0x18, 0x08, 0x10, 0x18, 0x00, 0x01,
+    },
+    {
+        0x00, 0x08, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00,
+        0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x37, 0x08, 0x1d, 0x0a,
+        0x20, 0x06, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x37, 0x12, 0x2a, 0x31, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+        0x2b, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x39, 0x00, 0x21, 0x08, 0x22, 0x00,
+    },
+    {
+        0x07, 0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17,
+        0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x0f,
+        0x29, 0x05, 0x09, 0x28, 0x09, 0x09, 0x09, 0x01, 0x0d, 0x06, 0x3b, 0x13, 0x0a, 0x02,
+    },
+    {
+        0x0a, 0x24, 0x06, 0x00, 0x20, 0x08, 0x00, 0x20, 0x08, 0x00, 0x20, 0x08, 0x00, 0x20,
+        0x08, 0x00, 0x20, 0x08, 0x00, 0x20, 0x08, 0x00, 0x20, 0x08, 0x25, 0x02, 0x00, 0x24,
+        0x02, 0x35, 0x18, 0x12, 0x14, 0x34, 0x00, 0x18, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x12, 0x2a, 0x31, 0x14, 0x0c,
+    },
+    {
+        0x2c, 0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02,
+        0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x11,
+        0x1d, 0x06, 0x08, 0x10, 0x04, 0x02, 0x06, 0x2f, 0x39, 0x00, 0x21, 0x08, 0x22, 0x00,
+    },
+    {
+        0x12, 0x14, 0x06, 0x12, 0x02, 0x00, 0x12, 0x02, 0x00, 0x12, 0x02, 0x00, 0x12, 0x02,
+        0x00, 0x12, 0x02, 0x00, 0x12, 0x02, 0x00, 0x12, 0x02, 0x00, 0x0a, 0x02, 0x00, 0x0a,
+        0x24, 0x0c, 0x00, 0x0a, 0x21, 0x06, 0x20, 0x18, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c,
+        0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x0a, 0x20, 0x06, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f,
+        0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x0a,
+        0x20, 0x06, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x37, 0x12, 0x2a, 0x31, 0x14, 0x0c,
+    },
+    {
+        0x00, 0x05, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00,
+        0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x11,
+        0x04, 0x03, 0x00, 0x36, 0x03, 0x00, 0x36, 0x03, 0x39, 0x00, 0x21, 0x08, 0x22, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+        0x12, 0x1d, 0x1d, 0x14, 0x06, 0x12, 0x06, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x0a, 0x20, 0x06, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f,
+        0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x11,
+        0x04, 0x03, 0x00, 0x36, 0x03, 0x00, 0x36, 0x03, 0x20, 0x00, 0x00, 0x39, 0x02, 0x00,
+    },
+    {
+        0x31, 0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20,
+        0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x31,
+        0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x12, 0x2a, 0x31, 0x02, 0x00,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x03,
+        0x12, 0x1d, 0x1d, 0x14, 0x06, 0x12, 0x06, 0x00, 0x18, 0x08, 0x10, 0x18, 0x00, 0x01,
+    },
+    {
+        0x35, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x35,
+        0x20, 0x05, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x37, 0x12, 0x0c, 0x31, 0x05, 0x00,
+    },
+    {
+        0x08, 0x3a, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a,
+        0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x08,
+        0x3a, 0x00, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x0e, 0x02, 0x06, 0x00, 0x02, 0x1f, 0x00, 0x02, 0x1f, 0x00, 0x02, 0x1f, 0x00, 0x02,
+        0x1f, 0x00, 0x02, 0x1f, 0x00, 0x02, 0x1f, 0x00, 0x02, 0x1f, 0x19, 0x20, 0x08, 0x2c,
+        0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x19, 0x02, 0x16, 0x09, 0x11, 0x19,
+    },
+    {
+        0x08, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x0e, 0x0b,
+        0x0b, 0x0e, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x1a, 0x0b, 0x00, 0x11,
+        0x1d, 0x06, 0x08, 0x10, 0x04, 0x02, 0x06, 0x2f, 0x00, 0x00, 0x33, 0x13, 0xbc, 0x00,
+    },
+    {
+        0x35, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x0c,
+        0x00, 0x26, 0x33, 0x09, 0x09, 0x20, 0x08, 0x18, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x35, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x20,
+        0x00, 0x00, 0x39, 0x02, 0x00, 0x06, 0x25, 0x25, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+        0x02, 0x26, 0x33, 0x09, 0x08, 0x19, 0x19, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x1c, 0x1c, 0x00, 0x1c, 0x2f, 0x00, 0x1c, 0x2f, 0x00, 0x1c, 0x2f, 0x00, 0x1c, 0x2f,
+        0x00, 0x1c, 0x2f, 0x00, 0x1c, 0x2f, 0x00, 0x1c, 0x2f, 0x00, 0x06, 0x20, 0x20, 0x0f,
+        0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x05, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x08, 0x0b, 0x0b, 0x1b, 0x0b, 0x0b, 0x1b, 0x0b, 0x0b, 0x1b, 0x0b, 0x0b, 0x1b, 0x0b,
+        0x0b, 0x1b, 0x0b, 0x0b, 0x1b, 0x0b, 0x0b, 0x1b, 0x0b, 0x0b, 0x1e, 0x0b, 0x00, 0x0a,
+        0x20, 0x06, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x00, 0x35, 0x20, 0x05, 0x34, 0x34, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x01, 0x18,
+        0x18, 0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x0a,
+        0x20, 0x06, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x25, 0x10, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00,
+        0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x10, 0x07, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1d, 0x34, 0x13, 0x01, 0x00,
+    },
+    {
+        0x0a, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x19, 0x35, 0x18,
+        0x07, 0x06, 0x35, 0x10, 0x34, 0x05, 0x09, 0x24, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x0a, 0x24, 0x06, 0x00, 0x20, 0x08, 0x00, 0x20, 0x08, 0x00, 0x20, 0x08, 0x00, 0x20,
+        0x08, 0x00, 0x20, 0x08, 0x00, 0x20, 0x08, 0x00, 0x20, 0x08, 0x25, 0x02, 0x00, 0x24,
+        0x02, 0x35, 0x18, 0x12, 0x14, 0x34, 0x00, 0x18, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18,
+        0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x33, 0x20, 0x15,
+        0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x39, 0x00, 0x21, 0x08, 0x22, 0x00,
+    },
+    {
+        0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17,
+        0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x20,
+        0x00, 0x00, 0x39, 0x02, 0x00, 0x06, 0x25, 0x25, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x1f, 0x1c, 0x2f, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c,
+        0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x09, 0x18, 0x11, 0x19,
+        0x02, 0x16, 0x09, 0x11, 0x19, 0x16, 0x11, 0x13, 0x1a, 0x12, 0x2e, 0x19, 0x02, 0x00,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x1f,
+        0x0c, 0x08, 0x25, 0x06, 0x08, 0x00, 0x00, 0x34, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x33, 0x13, 0xbc, 0x00, 0x11, 0x14, 0x04, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17,
+        0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x04,
+        0x1e, 0x06, 0x1e, 0xc2, 0x0e, 0x09, 0x11, 0x13, 0x0d, 0x06, 0x3b, 0x13, 0x0a, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+        0xbc, 0x21, 0x01, 0xbc, 0x01, 0x06, 0x1f, 0x19, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x11, 0x23, 0x00, 0x1f, 0x06, 0x00, 0x08, 0x3a, 0x00, 0x00, 0x3a, 0x01,
+    },
+    {
+        0x31, 0x32, 0x00, 0x31, 0x32, 0x12, 0x31, 0x32, 0x12, 0x31, 0x32, 0x12, 0x31, 0x32,
+        0x12, 0x31, 0x32, 0x12, 0x31, 0x32, 0x12, 0x31, 0x32, 0x12, 0x31, 0x32, 0x30, 0x31,
+        0x32, 0x00, 0x31, 0x32, 0x12, 0x31, 0x32, 0x30, 0x37, 0x06, 0x3a, 0x31, 0x05, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x20, 0x0a, 0x31, 0x00, 0x00,
+    },
+    {
+        0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23,
+        0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x08, 0x01,
+        0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x31, 0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20,
+        0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x31,
+        0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x31, 0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20,
+        0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x31,
+        0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x33, 0x00, 0x08, 0x33, 0x00, 0x08, 0x33, 0x00, 0x08, 0x33, 0x00,
+        0x08, 0x33, 0x00, 0x08, 0x33, 0x00, 0x08, 0x33, 0x00, 0x08, 0x18, 0x04, 0x28, 0x1f,
+        0x0c, 0x08, 0x25, 0x06, 0x08, 0x00, 0x00, 0x34, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x06, 0x1c, 0x05, 0x25, 0x1c, 0x25, 0x25, 0x1c, 0x25, 0x25, 0x1c, 0x25, 0x25, 0x1c,
+        0x25, 0x25, 0x1c, 0x25, 0x25, 0x1c, 0x25, 0x25, 0x1c, 0x25, 0x1f, 0x18, 0x34, 0x0a,
+        0x2b, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x39, 0x02, 0x26, 0x33, 0x09, 0x08,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+        0x2b, 0x00, 0x07, 0x17, 0x00, 0x07, 0x17, 0x25, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+        0x0d, 0x12, 0x10, 0x0f, 0x00, 0x00, 0x27, 0x03, 0x39, 0x00, 0x21, 0x08, 0x22, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+        0x04, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x37, 0x3a, 0x18, 0x31, 0x3a, 0x1f,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d,
+        0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x01,
+        0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0x05,
+        0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x05, 0x3a, 0x3a, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x08, 0x0b, 0x0b, 0x1b, 0x0b, 0x0b, 0x1b, 0x0b, 0x0b, 0x1b, 0x0b, 0x0b, 0x1b, 0x0b,
+        0x0b, 0x1b, 0x0b, 0x0b, 0x1b, 0x0b, 0x0b, 0x1b, 0x0b, 0x0b, 0x1e, 0x0b, 0x00, 0x11,
+        0x1d, 0x06, 0x08, 0x10, 0x04, 0x02, 0x06, 0x2f, 0x00, 0x00, 0x33, 0x13, 0xbc, 0x00,
+    },
+    {
+        0x08, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x0e, 0x0b,
+        0x0b, 0x0e, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x1a, 0x0b, 0x00, 0x11,
+        0x04, 0x03, 0x00, 0x36, 0x03, 0x00, 0x36, 0x03, 0x38, 0x14, 0x0c, 0x00, 0x08, 0x06,
+    },
+    {
+        0x39, 0x00, 0x21, 0x08, 0x22, 0x00, 0x08, 0x22, 0x00, 0x08, 0x22, 0x00, 0x08, 0x22,
+        0x00, 0x08, 0x22, 0x00, 0x08, 0x22, 0x00, 0x08, 0x22, 0x00, 0x10, 0x14, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1d, 0x34, 0x13, 0x01, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x33, 0x00, 0x08, 0x33, 0x00, 0x08, 0x33, 0x00, 0x08, 0x33, 0x00,
+        0x08, 0x33, 0x00, 0x08, 0x33, 0x00, 0x08, 0x33, 0x00, 0x08, 0x18, 0x04, 0x28, 0x35,
+        0x20, 0x05, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x08, 0x3a, 0x00, 0x00, 0x3a, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+        0x0c, 0x0c, 0x20, 0x0a, 0x06, 0x11, 0x14, 0x00, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x2c, 0x23, 0x00, 0x2c, 0x23, 0x00, 0x2c, 0x23, 0x00, 0x2c, 0x23, 0x00, 0x2c, 0x23,
+        0x00, 0x2c, 0x23, 0x00, 0x2c, 0x23, 0x00, 0x2c, 0x23, 0x00, 0x2c, 0x23, 0x30, 0x2c,
+        0x23, 0x00, 0x2c, 0x23, 0x00, 0x2c, 0x23, 0x30, 0x11, 0x1d, 0x34, 0x13, 0x01, 0x00,
+    },
+    {
+        0x05, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a,
+        0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x05, 0x3a, 0x3a, 0x05,
+        0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x05, 0x3a, 0x3a, 0x2c, 0x10, 0x21, 0x2c, 0x02, 0x33,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+        0x14, 0x0c, 0x00, 0x08, 0x06, 0x20, 0x1b, 0x34, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x33, 0x00, 0x08, 0x33, 0x00, 0x08, 0x33, 0x00, 0x08, 0x33, 0x00,
+        0x08, 0x33, 0x00, 0x08, 0x33, 0x00, 0x08, 0x33, 0x00, 0x08, 0x18, 0x04, 0x28, 0x1f,
+        0x0c, 0x08, 0x25, 0x06, 0x0e, 0x06, 0x00, 0x18, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x06, 0x0e, 0x00, 0x16, 0x16, 0x00, 0x16, 0x16, 0x00, 0x16, 0x16, 0x00, 0x16, 0x16,
+        0x00, 0x16, 0x16, 0x00, 0x16, 0x16, 0x00, 0x16, 0x16, 0x00, 0x1d, 0x20, 0x20, 0x18,
+        0x24, 0x06, 0x0a, 0x10, 0x18, 0x11, 0x24, 0x18, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x31, 0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20,
+        0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x1d,
+        0xbe, 0x05, 0x1d, 0xbe, 0x05, 0x1d, 0xbe, 0x05, 0x0e, 0x02, 0x06, 0x00, 0x02, 0x1f,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+        0xbc, 0x21, 0x01, 0xbc, 0x01, 0x06, 0x1f, 0x19, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x08, 0x3a, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a,
+        0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x08,
+        0x3a, 0x00, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+        0xbe, 0x10, 0x0e, 0x12, 0x33, 0x03, 0x06, 0x30, 0x37, 0x06, 0x3a, 0x31, 0x05, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+        0x00, 0x21, 0x12, 0x14, 0x24, 0x06, 0x12, 0x00, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x0a, 0x20, 0x24, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x25, 0x03,
+        0x06, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x08, 0x02, 0x0b, 0x0a,
+        0x20, 0x06, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+        0x21, 0x21, 0x35, 0x02, 0x08, 0x10, 0x02, 0x05, 0x39, 0x00, 0x21, 0x08, 0x22, 0x00,
+    },
+    {
+        0x33, 0x34, 0x06, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18,
+        0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x08, 0x33,
+        0x34, 0x06, 0x01, 0x18, 0x00, 0x01, 0x18, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00,
+        0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x1c,
+        0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x11, 0x1d, 0x34, 0x13, 0x01, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x14, 0x0c, 0x00, 0x0a, 0x21, 0x35, 0x02, 0x00, 0x01, 0x14, 0x0c, 0x00, 0x00, 0x00,
+    },
+    {
+        0x2c, 0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02,
+        0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x35,
+        0x20, 0x05, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x37, 0x12, 0x2a, 0x31, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x05,
+        0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x05, 0x3a, 0x3a, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x20, 0x14, 0x00, 0x00, 0x21, 0x18, 0x12, 0x0b, 0x18, 0x0a, 0x2b, 0x00, 0x01, 0x33,
+    },
+    {
+        0x01, 0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d,
+        0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x01,
+        0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x37, 0x20, 0x0a, 0x31, 0x00, 0x00,
+    },
+    {
+        0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23,
+        0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x08, 0x01,
+        0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+        0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x06, 0x0c, 0x01, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00,
+        0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x13, 0x06,
+        0x0c, 0x01, 0x10, 0x00, 0x00, 0x00, 0x11, 0x13, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x18, 0x24, 0x06, 0x0a, 0x10, 0x18, 0x0a, 0x10, 0x18, 0x0a, 0x10, 0x18, 0x0a, 0x10,
+        0x18, 0x0a, 0x10, 0x18, 0x0a, 0x10, 0x18, 0x0a, 0x10, 0x18, 0x11, 0x24, 0x18, 0x31,
+        0x32, 0x00, 0x31, 0x32, 0x12, 0x31, 0x32, 0x30, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x01, 0x32,
+        0x02, 0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x01,
+        0x32, 0x02, 0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x39, 0x02, 0x26, 0x33, 0x09, 0x08,
+    },
+    {
+        0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x01, 0x32,
+        0x02, 0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x01,
+        0x32, 0x02, 0x01, 0x32, 0x02, 0x01, 0x32, 0x02, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x10, 0x25, 0x05, 0x06, 0xbc, 0x05, 0x06, 0xbc, 0x05, 0x06, 0xbc, 0x05, 0x06, 0xbc,
+        0x05, 0x06, 0xbc, 0x05, 0x06, 0xbc, 0x05, 0x06, 0xbc, 0x05, 0x06, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x06, 0x36, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00,
+        0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x24, 0x0b, 0x34, 0x16,
+        0x00, 0x00, 0x03, 0x0c, 0x0a, 0x19, 0x0a, 0x19, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x0b, 0x02, 0x00, 0x0b, 0x02, 0x00, 0x0b, 0x02, 0x00, 0x0b, 0x02, 0x00, 0x0b,
+        0x02, 0x00, 0x0b, 0x02, 0x00, 0x0b, 0x02, 0x00, 0x0b, 0x02, 0x00, 0x36, 0x00, 0x0b,
+        0x0c, 0x0c, 0x0b, 0x02, 0x30, 0x00, 0x00, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x00,
+        0x06, 0x36, 0x00, 0x00, 0x11, 0x24, 0x0b, 0x34, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+        0x04, 0x03, 0x00, 0x36, 0x03, 0x00, 0x36, 0x03, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x05, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00,
+        0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x01,
+        0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x06, 0x36, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00,
+        0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x24, 0x0b, 0x34, 0x31,
+        0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x37, 0x12, 0x2a, 0x31, 0x14, 0x0c,
+    },
+    {
+        0x35, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x08,
+        0x3a, 0x00, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00,
+        0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x1c,
+        0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x11, 0x1d, 0x34, 0x13, 0x01, 0x00,
+    },
+    {
+        0x00, 0x12, 0x0f, 0x11, 0x24, 0x21, 0x11, 0x24, 0x21, 0x11, 0x24, 0x21, 0x11, 0x24,
+        0x21, 0x11, 0x24, 0x21, 0x11, 0x24, 0x21, 0x11, 0x24, 0x21, 0x35, 0x02, 0x05, 0x06,
+        0x25, 0x0c, 0x06, 0x02, 0x12, 0x14, 0x02, 0x18, 0x01, 0x14, 0x0c, 0x00, 0x00, 0x00,
+    },
+    {
+        0x20, 0x08, 0x10, 0x06, 0x22, 0x19, 0x06, 0x22, 0x19, 0x06, 0x22, 0x19, 0x06, 0x22,
+        0x19, 0x06, 0x22, 0x19, 0x06, 0x22, 0x19, 0x06, 0x22, 0x19, 0x02, 0x22, 0x18, 0x20,
+        0x08, 0x10, 0x06, 0x22, 0x19, 0x02, 0x22, 0x18, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x0a, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x19, 0x35, 0x12,
+        0x14, 0x24, 0x34, 0x2e, 0x30, 0x1f, 0x06, 0x08, 0x39, 0x00, 0x21, 0x08, 0x22, 0x00,
+    },
+    {
+        0x2c, 0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02,
+        0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x2c,
+        0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d,
+        0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x01,
+        0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x2c, 0x02, 0x0e, 0x2c, 0x02, 0x01,
+    },
+    {
+        0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17,
+        0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x01,
+        0x14, 0x0c, 0x00, 0x00, 0x00, 0x1b, 0x06, 0x01, 0x1a, 0x12, 0x2e, 0x19, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x12, 0x2a, 0x31, 0x02, 0x00,
+    },
+    {
+        0x2c, 0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02,
+        0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x0a,
+        0x20, 0x06, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x05, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a,
+        0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x05, 0x3a, 0x3a, 0x0c,
+        0x00, 0x26, 0x33, 0x09, 0x09, 0x20, 0x08, 0x18, 0x2c, 0x02, 0x0e, 0x2c, 0x02, 0x01,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06,
+        0x0c, 0x01, 0x10, 0x00, 0x00, 0x00, 0x11, 0x13, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x14, 0x24, 0x34, 0x2e, 0x30, 0x1f, 0x06, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x07, 0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17,
+        0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x0d,
+        0x06, 0x3b, 0x13, 0x0a, 0x02, 0x00, 0x27, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x11, 0x1d, 0x06, 0x08, 0x10, 0x04, 0x08, 0x10, 0x04, 0x08, 0x10, 0x04, 0x08, 0x10,
+        0x04, 0x08, 0x10, 0x04, 0x08, 0x10, 0x04, 0x08, 0x10, 0x04, 0x02, 0x06, 0x2f, 0x2c,
+        0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x1f, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a,
+        0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x0c, 0x00, 0x20, 0x07,
+        0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x37, 0x12, 0x2a, 0x31, 0x02, 0x00,
+    },
+    {
+        0x08, 0x3a, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a,
+        0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x08,
+        0x3a, 0x00, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x39, 0x00, 0x21, 0x08, 0x22, 0x00, 0x08, 0x22, 0x00, 0x08, 0x22, 0x00, 0x08, 0x22,
+        0x00, 0x08, 0x22, 0x00, 0x08, 0x22, 0x00, 0x08, 0x22, 0x00, 0x10, 0x14, 0x00, 0x37,
+        0x12, 0x2a, 0x31, 0x02, 0x00, 0x12, 0x06, 0x09, 0x11, 0x1d, 0x34, 0x13, 0x01, 0x00,
+    },
+    {
+        0x0a, 0x20, 0x06, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f,
+        0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x31,
+        0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x14, 0x24, 0x34, 0x2e, 0x30, 0x1f, 0x06, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x05, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a,
+        0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x05, 0x3a, 0x3a, 0x38,
+        0x04, 0x02, 0x33, 0x00, 0x11, 0x04, 0x00, 0x00, 0x39, 0x00, 0x21, 0x08, 0x22, 0x00,
+    },
+    {
+        0x05, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a,
+        0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x06, 0x3a, 0x3a, 0x05, 0x3a, 0x3a, 0x0a,
+        0x3a, 0x10, 0x2b, 0x18, 0x38, 0x38, 0x0e, 0x02, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17,
+        0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x0a,
+        0x17, 0x03, 0x11, 0x13, 0x14, 0x00, 0x05, 0x35, 0x01, 0x14, 0x0c, 0x00, 0x00, 0x00,
+    },
+    {
+        0x38, 0x04, 0x02, 0x33, 0x00, 0x11, 0x33, 0x00, 0x11, 0x33, 0x00, 0x11, 0x33, 0x00,
+        0x11, 0x33, 0x00, 0x11, 0x33, 0x00, 0x11, 0x33, 0x00, 0x11, 0x04, 0x00, 0x00, 0x36,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x00, 0x01,
+        0x05, 0x30, 0x04, 0x30, 0x2e, 0x06, 0x0e, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x06, 0x0e, 0x00, 0x16, 0x16, 0x00, 0x16, 0x16, 0x00, 0x16, 0x16, 0x00, 0x16, 0x16,
+        0x00, 0x16, 0x16, 0x00, 0x16, 0x16, 0x00, 0x16, 0x16, 0x00, 0x1d, 0x20, 0x20, 0x18,
+        0x0a, 0x2b, 0x00, 0x01, 0x33, 0x02, 0x24, 0x25, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+        0x20, 0x06, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x30, 0x09, 0x20, 0x20, 0x06, 0x20, 0x20, 0x06, 0x20, 0x20, 0x06, 0x20, 0x20, 0x06,
+        0x20, 0x20, 0x06, 0x20, 0x20, 0x06, 0x20, 0x20, 0x06, 0x20, 0x21, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x00, 0x35, 0x20, 0x05, 0x34, 0x34, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+        0x00, 0x00, 0x03, 0x0c, 0x0a, 0x19, 0x0a, 0x19, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+        0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x11, 0x13, 0x0e, 0x01, 0x0d, 0x11,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x11, 0x06, 0x09, 0x35, 0x16, 0x10, 0x35, 0x16, 0x10, 0x35, 0x16, 0x10, 0x35, 0x16,
+        0x10, 0x35, 0x16, 0x10, 0x35, 0x16, 0x10, 0x35, 0x16, 0x10, 0xc0, 0x13, 0x0d, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x1f, 0x1c, 0x2f, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c,
+        0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x09, 0x18, 0x11, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x01,
+        0x30, 0x21, 0xc2, 0x2e, 0x11, 0x19, 0x25, 0x01, 0x01, 0x14, 0x0c, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06,
+        0x0c, 0x0c, 0x00, 0x00, 0x12, 0x24, 0x1d, 0x1d, 0x18, 0x0a, 0x2b, 0x00, 0x01, 0x33,
+    },
+    {
+        0x00, 0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15,
+        0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03,
+        0x12, 0x1d, 0x1d, 0x14, 0x06, 0x12, 0x06, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17,
+        0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x0a,
+        0x17, 0x03, 0x11, 0x13, 0x14, 0x00, 0x05, 0x35, 0x11, 0x1d, 0x34, 0x13, 0x01, 0x00,
+    },
+    {
+        0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17,
+        0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x12, 0x14, 0x06, 0x12, 0x02, 0x00, 0x12, 0x02, 0x00, 0x12, 0x02, 0x00, 0x12, 0x02,
+        0x00, 0x12, 0x02, 0x00, 0x12, 0x02, 0x00, 0x12, 0x02, 0x00, 0x0a, 0x02, 0x00, 0x0a,
+        0x24, 0x0c, 0x00, 0x0a, 0x21, 0x06, 0x20, 0x18, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x33, 0x34, 0x06, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18,
+        0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x08, 0x33,
+        0x34, 0x06, 0x01, 0x18, 0x00, 0x01, 0x18, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x00, 0x01,
+        0x05, 0x30, 0x04, 0x30, 0x2e, 0x06, 0x0e, 0x00, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x35, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x35,
+        0x20, 0x05, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x37, 0x12, 0x0c, 0x31, 0x05, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x07, 0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07,
+        0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03,
+        0x36, 0x03, 0x11, 0x24, 0x1d, 0x24, 0x03, 0x06, 0x18, 0x0a, 0x2b, 0x00, 0x01, 0x33,
+    },
+    {
+        0x00, 0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15,
+        0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03,
+        0x12, 0x1d, 0x1d, 0x14, 0x06, 0x12, 0x06, 0x00, 0x39, 0x00, 0x21, 0x08, 0x22, 0x00,
+    },
+    {
+        0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18,
+        0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x33, 0x20, 0x00,
+        0x18, 0x14, 0x35, 0x1d, 0x06, 0x14, 0x00, 0x3b, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x07, 0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17,
+        0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x06, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x19, 0x00, 0x21, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x2f, 0x08, 0x18, 0x1c, 0x00, 0x18, 0x1c, 0x00, 0x18, 0x1c, 0x00, 0x18, 0x1c, 0x00,
+        0x18, 0x1c, 0x00, 0x18, 0x1c, 0x00, 0x18, 0x1c, 0x00, 0x18, 0x00, 0x20, 0x18, 0x00,
+        0x18, 0x14, 0x35, 0x1d, 0x06, 0x14, 0x00, 0x3b, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x00, 0x07, 0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07,
+        0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03,
+        0x36, 0x03, 0x11, 0x24, 0x1d, 0x24, 0x03, 0x06, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x0a, 0x20, 0x24, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x25, 0x03,
+        0x06, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x08, 0x02, 0x0b, 0x1c,
+        0x1c, 0x00, 0x1c, 0x2f, 0x00, 0x06, 0x20, 0x20, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x08, 0x25, 0x33, 0x2e, 0x06, 0x1b, 0x2e, 0x06, 0x1b, 0x2e, 0x06, 0x1b, 0x2e, 0x06,
+        0x1b, 0x2e, 0x06, 0x1b, 0x2e, 0x06, 0x1b, 0x2e, 0x06, 0x1b, 0x06, 0x00, 0x13, 0x37,
+        0x3a, 0x18, 0x31, 0x3a, 0x1f, 0x31, 0x3a, 0xbe, 0x18, 0x08, 0x10, 0x18, 0x00, 0x01,
+    },
+    {
+        0x35, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x35,
+        0x20, 0x05, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x08, 0x3a, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a,
+        0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x08,
+        0x3a, 0x00, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x1f, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a,
+        0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x0c, 0x00, 0x20, 0x07,
+        0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x37, 0x12, 0x2a, 0x31, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x02, 0x26, 0x33, 0x09, 0x08,
+    },
+    {
+        0x35, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x35,
+        0x20, 0x05, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x00, 0x05, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00,
+        0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x0e,
+        0x16, 0x1b, 0x11, 0x1d, 0x10, 0xbc, 0x3a, 0x05, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x26,
+        0x00, 0x21, 0x12, 0x14, 0x24, 0x06, 0x12, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x12, 0x0f, 0x11, 0x24, 0x21, 0x35, 0x02, 0x05, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x35, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x35,
+        0x20, 0x05, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x37, 0x12, 0x0c, 0x31, 0x05, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c,
+        0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x39, 0x02, 0x26, 0x33, 0x09, 0x08,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x25, 0x33, 0x2e, 0x06, 0x1b, 0x06, 0x00, 0x13, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+        0x03, 0x00, 0x27, 0x03, 0x00, 0x27, 0x03, 0x00, 0x39, 0x02, 0x26, 0x33, 0x09, 0x08,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+        0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x0a, 0x24, 0x0c, 0x08, 0x0d, 0x21,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d,
+        0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x25,
+        0x1c, 0x04, 0x01, 0x1c, 0x1d, 0x1d, 0x06, 0x08, 0x01, 0x14, 0x0c, 0x00, 0x00, 0x00,
+    },
+    {
+        0x07, 0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17,
+        0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x01,
+        0x30, 0x21, 0xc2, 0x2e, 0x11, 0x19, 0x25, 0x01, 0x1a, 0x12, 0x2e, 0x19, 0x02, 0x00,
+    },
+    {
+        0x08, 0x3a, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a,
+        0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x08,
+        0x3a, 0x00, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x33, 0x34, 0x06, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18,
+        0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x08, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x08, 0x3a, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a,
+        0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x08,
+        0x3a, 0x00, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x37, 0x12, 0x2a, 0x31, 0x14, 0x0c,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x16, 0x1b, 0x11, 0x1d, 0x10, 0xbc, 0x3a, 0x05, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x08, 0x3a, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a,
+        0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x08,
+        0x3a, 0x00, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x2c, 0x02, 0x0e, 0x2c, 0x02, 0x01,
+    },
+    {
+        0x35, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x35,
+        0x20, 0x05, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+        0x08, 0x10, 0x18, 0x00, 0x01, 0x1f, 0x06, 0x12, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x12, 0x04, 0x16, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17,
+        0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x0a,
+        0x2b, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x20, 0x00, 0x00, 0x39, 0x02, 0x00,
+    },
+    {
+        0x2c, 0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02,
+        0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x2c,
+        0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x37, 0x12, 0x0c, 0x31, 0x05, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x16, 0x1b, 0x11, 0x1d, 0x10, 0xbc, 0x3a, 0x05, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x33, 0x34, 0x06, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18,
+        0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x08, 0x2c,
+        0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x26, 0x00, 0x00, 0x27, 0x00, 0x00, 0x3b, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18,
+        0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x33, 0x20, 0x06,
+        0x0c, 0x0c, 0x00, 0x00, 0x12, 0x24, 0x1d, 0x1d, 0x39, 0x02, 0x26, 0x33, 0x09, 0x08,
+    },
+    {
+        0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17,
+        0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x0a,
+        0x17, 0x03, 0x11, 0x13, 0x14, 0x00, 0x05, 0x35, 0x11, 0x1d, 0x34, 0x13, 0x01, 0x00,
+    },
+    {
+        0x07, 0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17,
+        0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x0d,
+        0x06, 0x3b, 0x13, 0x0a, 0x02, 0x00, 0x27, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x35, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x0a,
+        0x20, 0x06, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x37,
+        0x12, 0x0c, 0x31, 0x05, 0x00, 0x31, 0x00, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x0a, 0x20, 0x24, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x25, 0x03,
+        0x06, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x08, 0x02, 0x0b, 0x00,
+        0x00, 0x20, 0x00, 0x35, 0x20, 0x05, 0x34, 0x34, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+        0x20, 0x06, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x37, 0x12, 0x0c, 0x31, 0x05, 0x00,
+    },
+    {
+        0x08, 0x3a, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a,
+        0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x08,
+        0x3a, 0x00, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x35, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x35,
+        0x20, 0x05, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x37, 0x12, 0x0c, 0x31, 0x05, 0x00,
+    },
+    {
+        0x0a, 0x20, 0x06, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f,
+        0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x38,
+        0x14, 0x0c, 0x00, 0x08, 0x06, 0x20, 0x1b, 0x34, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00,
+        0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x20,
+        0x20, 0x00, 0x00, 0x39, 0x02, 0x08, 0x1d, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x08, 0x1c, 0x18, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c,
+        0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x05, 0x3a, 0x0a,
+        0x06, 0x1b, 0x1f, 0x00, 0x00, 0x25, 0x00, 0x3b, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18,
+        0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x33, 0x20, 0x04,
+        0x16, 0x06, 0x36, 0x06, 0x0c, 0x01, 0x03, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x31, 0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20,
+        0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x2c, 0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02,
+        0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x1d,
+        0x20, 0x1d, 0x00, 0x18, 0x00, 0x33, 0x34, 0x06, 0x01, 0x14, 0x0c, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x05, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00,
+        0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x0e,
+        0x16, 0x1b, 0x11, 0x1d, 0x10, 0xbc, 0x3a, 0x05, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17,
+        0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x0a,
+        0x06, 0x1b, 0x1f, 0x00, 0x00, 0x25, 0x00, 0x3b, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x35, 0x20, 0x05, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14,
+        0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x34, 0x14, 0x09, 0x30, 0x20, 0x11, 0x0e,
+        0x02, 0x06, 0x00, 0x02, 0x1f, 0x19, 0x20, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x1c, 0x1c, 0x00, 0x1c, 0x2f, 0x00, 0x1c, 0x2f, 0x00, 0x1c, 0x2f, 0x00, 0x1c, 0x2f,
+        0x00, 0x1c, 0x2f, 0x00, 0x1c, 0x2f, 0x00, 0x1c, 0x2f, 0x00, 0x06, 0x20, 0x20, 0x39,
+        0x02, 0x26, 0x33, 0x09, 0x08, 0x19, 0x19, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x16, 0x0c, 0x35, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00,
+        0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x19, 0x30, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x01, 0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d,
+        0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x01,
+        0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x12, 0x0f, 0x11, 0x24, 0x21, 0x35, 0x02, 0x05, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x2c, 0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02,
+        0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x06,
+        0x0c, 0x0c, 0x20, 0x0a, 0x06, 0x11, 0x14, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+        0x02, 0x26, 0x33, 0x09, 0x08, 0x19, 0x19, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x2c, 0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02,
+        0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x2c,
+        0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x37, 0x12, 0x2a, 0x31, 0x14, 0x0c,
+    },
+    {
+        0x0a, 0x21, 0x21, 0x35, 0x02, 0x08, 0x35, 0x02, 0x08, 0x35, 0x02, 0x08, 0x35, 0x02,
+        0x08, 0x35, 0x02, 0x08, 0x35, 0x02, 0x08, 0x35, 0x02, 0x08, 0x10, 0x02, 0x05, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c,
+        0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0d,
+        0x06, 0x3b, 0x13, 0x0a, 0x02, 0x00, 0x27, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+        0x04, 0x03, 0x00, 0x36, 0x03, 0x00, 0x36, 0x03, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x00,
+        0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x01, 0x14, 0x0c, 0x00, 0x00, 0x00,
+    },
+    {
+        0x26, 0x00, 0x21, 0x12, 0x14, 0x24, 0x12, 0x14, 0x24, 0x12, 0x14, 0x24, 0x12, 0x14,
+        0x24, 0x12, 0x14, 0x24, 0x12, 0x14, 0x24, 0x12, 0x14, 0x24, 0x06, 0x12, 0x00, 0x33,
+        0x34, 0x06, 0x01, 0x18, 0x00, 0x01, 0x18, 0x08, 0x37, 0x10, 0x21, 0x31, 0x12, 0x0c,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x10, 0x21, 0x2c, 0x02, 0x33,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+        0x12, 0x2e, 0x19, 0x02, 0x00, 0x33, 0x38, 0x00, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x0a, 0x06, 0x1b, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00,
+        0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x25, 0x00, 0x3b, 0x01,
+        0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x08, 0x3a, 0x00, 0x00, 0x3a, 0x01,
+    },
+    {
+        0x25, 0x1c, 0x04, 0x01, 0x1c, 0x1d, 0x01, 0x1c, 0x1d, 0x01, 0x1c, 0x1d, 0x01, 0x1c,
+        0x1d, 0x01, 0x1c, 0x1d, 0x01, 0x1c, 0x1d, 0x01, 0x1c, 0x1d, 0x1d, 0x06, 0x08, 0x0a,
+        0x2b, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x38, 0x14, 0x0c, 0x00, 0x08, 0x06,
+    },
+    {
+        0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x01, 0x18,
+        0x18, 0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x01,
+        0x18, 0x18, 0x01, 0x18, 0x18, 0x01, 0x18, 0x18, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x31, 0x32, 0x00, 0x31, 0x32, 0x12, 0x31, 0x32, 0x12, 0x31, 0x32, 0x12, 0x31, 0x32,
+        0x12, 0x31, 0x32, 0x12, 0x31, 0x32, 0x12, 0x31, 0x32, 0x12, 0x31, 0x32, 0x30, 0x31,
+        0x32, 0x00, 0x31, 0x32, 0x12, 0x31, 0x32, 0x30, 0x11, 0x1d, 0x34, 0x13, 0x01, 0x00,
+    },
+    {
+        0x0a, 0x20, 0x06, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f,
+        0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x30, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x36,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+        0x12, 0x10, 0x19, 0x10, 0x00, 0x00, 0x00, 0x3a, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23,
+        0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x08, 0x01,
+        0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x12, 0x0f, 0x11, 0x24, 0x21, 0x35, 0x02, 0x05, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x26,
+        0x03, 0x00, 0x27, 0x03, 0x00, 0x27, 0x03, 0x00, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+        0x00, 0x1c, 0x31, 0x00, 0x00, 0x31, 0x08, 0x1d, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04,
+        0x16, 0x06, 0x36, 0x06, 0x0c, 0x01, 0x03, 0x00, 0x01, 0x14, 0x0c, 0x00, 0x00, 0x00,
+    },
+    {
+        0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17,
+        0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x20, 0x0a, 0x31, 0x00, 0x00,
+    },
+    {
+        0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23,
+        0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x08, 0x01,
+        0x23, 0x00, 0x01, 0x23, 0x00, 0x01, 0x23, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+        0x03, 0x00, 0x27, 0x03, 0x00, 0x27, 0x03, 0x00, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x0a, 0x20, 0x24, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x25, 0x03,
+        0x06, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x25, 0x03, 0x06, 0x08, 0x02, 0x0b, 0x31,
+        0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x08, 0x25, 0x33, 0x2e, 0x06, 0x1b, 0x2e, 0x06, 0x1b, 0x2e, 0x06, 0x1b, 0x2e, 0x06,
+        0x1b, 0x2e, 0x06, 0x1b, 0x2e, 0x06, 0x1b, 0x2e, 0x06, 0x1b, 0x06, 0x00, 0x13, 0x11,
+        0x04, 0x03, 0x00, 0x36, 0x03, 0x00, 0x36, 0x03, 0x01, 0x14, 0x0c, 0x00, 0x00, 0x00,
+    },
+    {
+        0x1f, 0x1c, 0x2f, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c,
+        0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x09, 0x18, 0x11, 0x19,
+        0x02, 0x16, 0x09, 0x11, 0x19, 0x16, 0x11, 0x13, 0x1a, 0x12, 0x2e, 0x19, 0x02, 0x00,
+    },
+    {
+        0x2c, 0x02, 0x0e, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02,
+        0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x01, 0x2c, 0x02, 0x08, 0x33,
+        0x34, 0x06, 0x01, 0x18, 0x00, 0x01, 0x18, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37,
+        0x02, 0x06, 0x31, 0x02, 0x12, 0x31, 0x10, 0x19, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x07, 0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17,
+        0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x05,
+        0x09, 0x09, 0x09, 0x09, 0x01, 0x0d, 0x10, 0x09, 0x0d, 0x06, 0x3b, 0x13, 0x0a, 0x02,
+    },
+    {
+        0x08, 0x3a, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a,
+        0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x08,
+        0x3a, 0x00, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x00, 0x08,
+        0x3a, 0x00, 0x00, 0x3a, 0x01, 0x05, 0x3a, 0x11, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x1f, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a,
+        0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x14, 0x3a, 0x20, 0x0c, 0x00, 0x20, 0x07,
+        0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x37, 0x12, 0x2a, 0x31, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x31, 0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20,
+        0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x00,
+        0x12, 0x0f, 0x11, 0x24, 0x21, 0x35, 0x02, 0x05, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x31, 0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20,
+        0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x31,
+        0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x2f,
+        0x08, 0x18, 0x1c, 0x00, 0x18, 0x00, 0x20, 0x18, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17,
+        0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x01,
+        0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x07, 0x2b, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17,
+        0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x07, 0x17, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x01, 0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d,
+        0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x01,
+        0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x26, 0x03, 0x00, 0x27, 0x03, 0x00, 0x27, 0x03, 0x00, 0x27, 0x03, 0x00, 0x27, 0x03,
+        0x00, 0x27, 0x03, 0x00, 0x27, 0x03, 0x00, 0x27, 0x03, 0x00, 0x27, 0x03, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x33, 0x20, 0x26, 0x0b, 0x02, 0x00, 0x0b, 0x02, 0x00, 0x0b, 0x02, 0x00, 0x0b, 0x02,
+        0x00, 0x0b, 0x02, 0x00, 0x0b, 0x02, 0x00, 0x0b, 0x02, 0x00, 0x34, 0x09, 0x09, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x12, 0x04, 0x16, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17,
+        0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x05, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00,
+        0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x0e,
+        0x16, 0x1b, 0x11, 0x1d, 0x10, 0xbc, 0x3a, 0x05, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17,
+        0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x0a,
+        0x2b, 0x03, 0x0a, 0x17, 0x03, 0x0a, 0x17, 0x03, 0x20, 0x00, 0x00, 0x39, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+        0x00, 0x00, 0x03, 0x0c, 0x0a, 0x19, 0x0a, 0x19, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x31, 0x20, 0x34, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20,
+        0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x05, 0x31, 0x20, 0x08, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x06, 0x36, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00,
+        0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x24, 0x0b, 0x34, 0x11,
+        0x1d, 0x34, 0x13, 0x01, 0x00, 0x14, 0x27, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x15, 0x04, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17,
+        0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x15, 0x17, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x11, 0x13, 0x0e, 0x01, 0x0d, 0x11, 0x01, 0x0d, 0x11, 0x01, 0x0d, 0x11, 0x01, 0x0d,
+        0x11, 0x01, 0x0d, 0x11, 0x01, 0x0d, 0x11, 0x01, 0x0d, 0x11, 0x05, 0x25, 0x24, 0x1d,
+        0xbe, 0x05, 0x1d, 0xbe, 0x05, 0x1d, 0xbe, 0x05, 0x37, 0x02, 0x06, 0x31, 0x02, 0x12,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+        0x20, 0x00, 0x00, 0x39, 0x02, 0x08, 0x1d, 0x00, 0x18, 0x08, 0x10, 0x18, 0x00, 0x01,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+    {
+        0x01, 0x2d, 0x30, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d,
+        0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x2d, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbc, 0x21, 0x01, 0xbc, 0x01,
+    },
+    {
+        0x00, 0x26, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27,
+        0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06, 0x27, 0x03, 0x06,
+        0x0c, 0x01, 0x10, 0x00, 0x00, 0x00, 0x11, 0x13, 0x01, 0x14, 0x0c, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+        0x2b, 0x00, 0x07, 0x17, 0x00, 0x07, 0x17, 0x25, 0x39, 0x0d, 0x12, 0x10, 0x0f, 0x00,
+    },
+};
+
+#ifndef MK_54
+static const uint8_t ik1306_useq_rom[CMD_NWORDS][REG_NWORDS] PROGMEM = {
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b,
+        0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x12, 0x14, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25,
+        0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x00,
+        0x3b, 0x05, 0x00, 0x3b, 0x05, 0x00, 0x3b, 0x05, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x24, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0x12, 0x12, 0x12, 0x12, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x24, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x12, 0x12, 0x12, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x24, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x12, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x24, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x0f, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x0f, 0x0f, 0x2a, 0x0f, 0x0f, 0x12, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x0e, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00,
+        0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00,
+        0x00, 0x00, 0x25, 0x00, 0x0e, 0x0f, 0x0f, 0x0f, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x29, 0x0f, 0x0f, 0x0f, 0x12, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x24, 0x02, 0x00,
+    },
+    {
+        0x0e, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00,
+        0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+        0x00, 0x00, 0x25, 0x00, 0x0e, 0x0f, 0x0f, 0x0f, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b,
+        0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x12, 0x14, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x11, 0x05, 0x00, 0x11, 0x05, 0x00, 0x11, 0x05, 0x00, 0x11, 0x05, 0x00, 0x11,
+        0x05, 0x00, 0x11, 0x05, 0x00, 0x11, 0x05, 0x00, 0x11, 0x05, 0x00, 0x11, 0x05, 0x00,
+        0x11, 0x05, 0x00, 0x11, 0x05, 0x00, 0x11, 0x05, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x11, 0x25, 0x00, 0x11, 0x25, 0x00, 0x11, 0x25, 0x00, 0x11, 0x25, 0x00, 0x11,
+        0x25, 0x00, 0x11, 0x25, 0x00, 0x11, 0x25, 0x00, 0x11, 0x25, 0x00, 0x11, 0x25, 0x00,
+        0x11, 0x25, 0x00, 0x11, 0x25, 0x00, 0x11, 0x25, 0x0c, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25,
+        0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x24, 0x25, 0x00, 0x03,
+        0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21,
+        0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03,
+        0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06,
+        0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x24, 0x02, 0x00, 0x24,
+        0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04,
+        0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x24, 0x02, 0x00, 0x24,
+        0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x01, 0x25, 0x00, 0x01, 0x25, 0x00, 0x01, 0x25, 0x00, 0x01, 0x25, 0x00, 0x01, 0x25,
+        0x00, 0x01, 0x25, 0x00, 0x01, 0x25, 0x00, 0x01, 0x25, 0x00, 0x24, 0x02, 0x00, 0x24,
+        0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00,
+        0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00,
+        0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16,
+        0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00,
+        0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+        0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+        0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x21, 0x00, 0x00, 0x21, 0x24, 0x00, 0x21, 0x24, 0x00, 0x21, 0x24, 0x00, 0x21,
+        0x24, 0x00, 0x21, 0x24, 0x00, 0x21, 0x24, 0x00, 0x21, 0x24, 0x25, 0x03, 0x25, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25,
+        0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x29, 0x2a, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b,
+        0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25,
+        0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x29, 0x2a, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b,
+        0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x3a, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x1b, 0x03, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17,
+        0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x21, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x16, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x2c, 0x2a, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b,
+        0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x00,
+        0x16, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16,
+        0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00,
+        0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21,
+        0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03,
+        0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x1f, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x16, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x30, 0x1d, 0x05, 0x2f, 0x1d, 0x00, 0x2f, 0x1d, 0x00, 0x2f, 0x1d, 0x00, 0x2f, 0x1d,
+        0x00, 0x2f, 0x1d, 0x00, 0x2f, 0x1d, 0x00, 0x2f, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x30,
+        0x1d, 0x05, 0x2f, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+        0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x0e, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x34,
+        0x2a, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21,
+        0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03,
+        0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21,
+        0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03,
+        0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x1b, 0x03, 0x00, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03,
+        0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x13, 0x39, 0x24, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x02, 0x00, 0x24, 0x02, 0x00, 0x13, 0x07, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x12, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x12, 0x14,
+        0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x12, 0x24,
+        0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25,
+        0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03,
+        0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x1b, 0x18, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+        0x03, 0x00, 0x0b, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+        0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x23, 0x02, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x1b, 0x03, 0x00, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03,
+        0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x13, 0x39, 0x24, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x02, 0x00, 0x24, 0x02, 0x00, 0x13, 0x07, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21,
+        0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03,
+        0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x1b, 0x03, 0x00, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03,
+        0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25,
+        0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03,
+        0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x12, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d,
+        0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00,
+        0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25,
+        0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03,
+        0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x12, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25,
+        0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03,
+        0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d,
+        0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00,
+        0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25,
+        0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x24, 0x25, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03,
+        0x18, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33,
+        0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x18, 0x25, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18,
+        0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33,
+        0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x18, 0x25, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18,
+        0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21,
+        0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+        0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x12, 0x12, 0x12, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x23, 0x02, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x12, 0x12, 0x12, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x24,
+        0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x12, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00,
+        0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00,
+        0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x1b, 0x03, 0x00, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03,
+        0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x03, 0x0b, 0x13, 0x39, 0x24, 0x00,
+        0xbe, 0x00, 0x00, 0xbe, 0x00, 0x00, 0xbe, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25,
+        0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03,
+        0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x30, 0x1d, 0x05, 0x2f, 0x1d, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x12, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x12, 0x12, 0x12, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25,
+        0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24,
+        0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+        0x0a, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x12, 0x12, 0x12, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25,
+        0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24,
+        0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x24, 0x00,
+        0x05, 0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x29,
+        0x12, 0x35, 0x29, 0xc2, 0x35, 0x29, 0xc2, 0x35, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+        0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x03, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00,
+        0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+        0x12, 0x35, 0x29, 0xc2, 0x35, 0x29, 0xc2, 0x35, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x1b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x02, 0x00, 0x36,
+        0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06,
+        0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x00,
+        0x03, 0x05, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x0c, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16,
+        0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21,
+        0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16,
+        0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00,
+        0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x0e, 0x02, 0x00, 0x24, 0x02, 0x00, 0x24, 0x02, 0x00, 0x24, 0x02, 0x00, 0x24, 0x02,
+        0x00, 0x24, 0x02, 0x00, 0x24, 0x02, 0x00, 0x24, 0x02, 0x00, 0x24, 0x02, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x1d, 0x05, 0x2f, 0x1d, 0x00,
+    },
+    {
+        0x36, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x0b,
+        0x00, 0x03, 0x0b, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x1b, 0x03, 0x0b, 0x1b, 0x03, 0x0b, 0x1b, 0x03, 0x0b, 0x1b, 0x03,
+        0x0b, 0x1b, 0x03, 0x0b, 0x1b, 0x03, 0x0b, 0x1b, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d,
+        0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00,
+        0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x24, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33,
+        0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x02, 0x00, 0x24, 0x02, 0x00, 0x24, 0x02, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x29, 0x12, 0x35, 0x29, 0xc2, 0x35, 0x29, 0xc2, 0x35, 0x29, 0xc2, 0x35, 0x29, 0xc2,
+        0x35, 0x29, 0xc2, 0x35, 0x29, 0xc2, 0x35, 0x29, 0xc2, 0x35, 0x29, 0xc2, 0x35, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x03, 0x00, 0x38, 0x03, 0x00, 0x0b, 0x03, 0x00, 0x0b, 0x03, 0x00, 0x0b, 0x03, 0x00,
+        0x0b, 0x03, 0x00, 0x0b, 0x03, 0x00, 0x0b, 0x03, 0x00, 0x0b, 0x03, 0x25, 0x00, 0x24,
+        0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25,
+        0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x24, 0x25, 0x00, 0x24, 0x25, 0x0e, 0x24, 0x25, 0x0e, 0x24, 0x25, 0x0e, 0x24, 0x25,
+        0x0e, 0x24, 0x25, 0x0e, 0x24, 0x25, 0x0e, 0x24, 0x25, 0x0e, 0x05, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+        0x18, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x02, 0x00, 0x24, 0x02, 0x00, 0x24, 0x02, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x1d, 0x05, 0x2f, 0x1d, 0x00,
+    },
+    {
+        0x1b, 0x03, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x0e, 0x34, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x29, 0x2a, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b,
+        0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x3a, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33,
+        0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x2c, 0x2a, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b,
+        0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x2c, 0x2a, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b,
+        0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33,
+        0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x2c, 0x2a, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b,
+        0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33,
+        0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x2c, 0x2a, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b,
+        0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x2c, 0x2a, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b,
+        0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33,
+        0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x2c, 0x2a, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b,
+        0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33,
+        0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x34, 0x2a, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b,
+        0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33,
+        0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x2c, 0x2a, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b,
+        0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16,
+        0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00,
+        0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x29, 0x2a, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b,
+        0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x3a, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16,
+        0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00,
+        0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16,
+        0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x00,
+        0x16, 0x05, 0x00, 0x16, 0x05, 0x00, 0x16, 0x05, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x29, 0x2a, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b,
+        0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x30, 0x1d, 0x05, 0x2f, 0x1d, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x12, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x29, 0x12, 0x00, 0x29, 0xc2, 0x00, 0x13, 0x0f, 0xc0, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+        0x03, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00,
+        0x29, 0x12, 0x00, 0x29, 0xc2, 0x00, 0x13, 0x0f, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21,
+        0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x03, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00,
+        0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x02, 0x00, 0x24, 0x02, 0x00, 0x24, 0x02, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x1b, 0x03, 0xbe, 0x1b, 0x03, 0xbe, 0x1b, 0x03, 0xbe, 0x1b, 0x03,
+        0xbe, 0x1b, 0x03, 0xbe, 0x1b, 0x03, 0xbe, 0x1b, 0x03, 0xbe, 0x00, 0x00, 0x00, 0x00,
+        0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x24, 0x02, 0x00,
+    },
+    {
+        0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d,
+        0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00,
+        0x0d, 0x05, 0x00, 0x0d, 0x05, 0x00, 0x0d, 0x05, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x00, 0x17, 0x00, 0x00, 0x17, 0x0e, 0x00, 0x17, 0x0e, 0x00, 0x17, 0x0e, 0x00, 0x17,
+        0x0e, 0x00, 0x17, 0x0e, 0x00, 0x17, 0x0e, 0x00, 0x17, 0x0e, 0x05, 0x0d, 0x02, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x2c, 0x2a, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b,
+        0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25,
+        0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03,
+        0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+        0x0a, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x28, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x16, 0x00, 0x00, 0x16, 0x00, 0x00, 0x16, 0x00, 0x00, 0x16, 0x00, 0x00, 0x16,
+        0x00, 0x00, 0x16, 0x00, 0x00, 0x16, 0x00, 0x00, 0x16, 0x00, 0x00, 0x16, 0x00, 0x00,
+        0x16, 0x00, 0x00, 0x16, 0x00, 0x00, 0x16, 0x00, 0x0c, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x0f, 0x02, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+        0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x00, 0x03,
+        0x05, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x00,
+        0x03, 0x05, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d,
+        0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00,
+        0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d,
+        0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00,
+        0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x1d, 0x05, 0x2f, 0x1d, 0x00,
+    },
+    {
+        0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x00, 0x03,
+        0x05, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x24,
+        0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x0d, 0x05, 0x00, 0x0d, 0x05, 0x00, 0x0d, 0x05, 0x00, 0x0d, 0x05, 0x00, 0x0d,
+        0x05, 0x00, 0x0d, 0x05, 0x00, 0x0d, 0x05, 0x00, 0x0d, 0x05, 0x00, 0x0d, 0x05, 0x24,
+        0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d,
+        0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00,
+        0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x30, 0x1d, 0x05, 0x2f, 0x1d, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x25, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x24, 0x00,
+        0x05, 0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x24,
+        0x00, 0x05, 0x24, 0x00, 0x05, 0x24, 0x00, 0x05, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00,
+        0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03,
+        0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x0e, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x2c,
+        0x02, 0x00, 0x24, 0x02, 0x00, 0x24, 0x02, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x00, 0x32, 0x03, 0x00, 0x32, 0x03, 0x00, 0x32, 0x03, 0x00, 0x32, 0x03, 0x00,
+        0x32, 0x03, 0x00, 0x32, 0x03, 0x00, 0x32, 0x03, 0x00, 0x32, 0x03, 0x00, 0x32, 0x03,
+        0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16,
+        0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x00,
+        0x16, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x24, 0x18, 0x03, 0x18, 0x05, 0x03, 0x18, 0x05, 0x03, 0x18, 0x05, 0x03, 0x18, 0x05,
+        0x03, 0x18, 0x05, 0x03, 0x18, 0x05, 0x03, 0x18, 0x05, 0x03, 0x18, 0x05, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21,
+        0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03,
+        0x12, 0x05, 0x2d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x26, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28,
+        0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x03,
+        0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x29, 0x2a, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b,
+        0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x29, 0x2b, 0x35, 0x34,
+        0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x26, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28,
+        0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x2c, 0x2a, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13,
+        0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x13, 0x2b, 0x27, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21,
+        0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03,
+        0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x29, 0x2a, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b,
+        0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x3a, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x00, 0x32, 0x03, 0x00, 0x32, 0x03, 0x00, 0x32, 0x03, 0x00, 0x32, 0x03, 0x00,
+        0x32, 0x03, 0x00, 0x32, 0x03, 0x00, 0x32, 0x03, 0x00, 0x32, 0x03, 0x00, 0x32, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00,
+        0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x24, 0x02, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x21, 0x00, 0x00, 0x21, 0x00, 0x00, 0x21, 0x00, 0x00, 0x21, 0x00, 0x00,
+        0x21, 0x00, 0x00, 0x21, 0x00, 0x00, 0x21, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00,
+        0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03,
+        0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x30, 0x1d, 0x05, 0x2f, 0x1d, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x23, 0x02, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x26, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28,
+        0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+        0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x12, 0x12, 0x12, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00,
+        0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x23, 0x02, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+        0x12, 0x12, 0x12, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x26, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27,
+        0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x0e,
+        0x0f, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00,
+        0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x23, 0x02, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x26, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27,
+        0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x29, 0x2a, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b,
+        0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x3a, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x13, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x0e,
+        0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0xbc, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x12, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x25, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x26, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28,
+        0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x24,
+        0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x23, 0x02, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00,
+        0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00,
+        0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x37, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+    },
+    {
+        0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00,
+        0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x03,
+        0x00, 0x25, 0x03, 0x00, 0x25, 0x03, 0x00, 0x25, 0x30, 0x1d, 0x05, 0x2f, 0x1d, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+        0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+        0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+        0x27, 0x00, 0x28, 0x27, 0x00, 0x28, 0x27, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+        0x2a, 0x27, 0x29, 0x2b, 0x27, 0x29, 0x2b, 0x3a, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25,
+        0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x03, 0x25, 0x00, 0x24, 0x25, 0x00, 0x13,
+        0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02,
+    },
+    {
+        0x01, 0x04, 0x08, 0x01, 0x04, 0x08, 0x01, 0x04, 0x08, 0x01, 0x04, 0x08, 0x01, 0x04,
+        0x08, 0x01, 0x04, 0x08, 0x01, 0x04, 0x08, 0x01, 0x04, 0x08, 0x24, 0x00, 0x1a, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x06, 0x09, 0x03, 0x06, 0x09, 0x03, 0x06, 0x09, 0x03, 0x06, 0x09, 0x03, 0x06,
+        0x09, 0x03, 0x06, 0x09, 0x03, 0x06, 0x09, 0x03, 0x06, 0x09, 0x24, 0x00, 0x02, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x19, 0x05, 0x00, 0x19, 0x05, 0x00, 0x19, 0x05, 0x00, 0x19, 0x05, 0x00,
+        0x19, 0x05, 0x00, 0x19, 0x05, 0x00, 0x19, 0x05, 0x00, 0x19, 0x05, 0x00, 0x00, 0x24,
+        0x25, 0x00, 0x24, 0x25, 0x00, 0x24, 0x25, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00,
+        0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x05, 0x24, 0x02, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b,
+        0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x12, 0x14, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x1b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21,
+        0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03,
+        0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x21, 0x02, 0x03, 0x12, 0x05, 0x2d, 0x02, 0x00,
+    },
+    {
+        0x03, 0x15, 0x00, 0x03, 0x15, 0x00, 0x03, 0x15, 0x00, 0x03, 0x15, 0x00, 0x03, 0x15,
+        0x00, 0x03, 0x15, 0x00, 0x03, 0x15, 0x00, 0x03, 0x15, 0x00, 0x03, 0x15, 0x00, 0x03,
+        0x15, 0x00, 0x03, 0x15, 0x00, 0x03, 0x15, 0x00, 0x0e, 0x02, 0x00, 0x24, 0x02, 0x00,
+    },
+};
+#endif
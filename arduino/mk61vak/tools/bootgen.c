@@ -0,0 +1,64 @@
+/*
+ * Generator of the power-on snapshot, see calc_ctx_init_fast().
+ *
+ * Powers up a calculator, steps it until the ROM settles in its
+ * idle loop with 0. on the display, and writes the machine state
+ * as a C array. Run again whenever the ROMs or the snapshot
+ * format change; a stale snapshot is rejected by calc_ctx_load_state()
+ * and calc_ctx_init_fast() falls back to stepping.
+ */
+// Build from the project directory and run:
+//  cc -O2 -Isrc -Isrc/mk61vak tools/bootgen.c src/mk61vak/*.c -lm -o bootgen
+//  ./bootgen src/mk61vak/boot.h
+#include <stdio.h>
+#include "calc.h"
+
+// Linked in by calc.c for the global calculator, unused here
+int calc_keypad (void) { return 0; }
+int calc_rgd (void) { return MODE_RADIANS; }
+void calc_display (int i, int digit, int dot) {}
+void calc_poll (void) {}
+void calc_running (int on) {}
+
+// Give up if the ROM never loops
+#define MAX_STEPS   100
+
+int main (int argc, char **argv)
+{
+    static calc_idle_t idle;
+    static calc_ctx_t c;
+    uint8_t buf [CALC_SAVE_SIZE];
+    size_t size, i;
+    unsigned steps;
+    FILE *out = stdout;
+
+    calc_ctx_init (&c);
+    calc_ctx_set_idle (&c, &idle);
+    for (steps=1; steps<=MAX_STEPS; steps++) {
+        calc_ctx_step (&c);
+        if (calc_ctx_idle (&c))
+            break;
+    }
+    if (steps > MAX_STEPS) {
+        fprintf (stderr, "bootgen: no idle loop after %u steps\n", MAX_STEPS);
+        return 1;
+    }
+    if (argc > 1 && ! (out = fopen (argv[1], "w"))) {
+        perror (argv[1]);
+        return 1;
+    }
+    size = calc_ctx_save_state (&c, buf);
+
+    fprintf (out, "/*\n");
+    fprintf (out, " * State of the calculator in its idle loop after power-on.\n");
+    fprintf (out, " * Generated by tools/bootgen.c, do not edit.\n");
+    fprintf (out, " */\n");
+    fprintf (out, "#define CALC_BOOT_STEPS %u\n\n", steps);
+    fprintf (out, "static const uint8_t calc_boot_state[] PROGMEM = {");
+    for (i=0; i<size; i++)
+        fprintf (out, "%s0x%02x,", i % 12 ? " " : "\n    ", buf[i]);
+    fprintf (out, "\n};\n");
+    if (out != stdout)
+        fclose (out);
+    return 0;
+}
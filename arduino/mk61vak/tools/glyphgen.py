@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+#
+# Glyph atlas generator for the ILC2-12/8L imitation.
+#
+# Reads the traced 8-bit VFD tilemap eggogpgm.c and writes eggog_atlas.h:
+# every cell ILC2128L draws (digit with or without dot, the half-digit
+# at position 9, the minus at position 0) rasterised once in the SH1122
+# RAM format, 4 bits per pixel, left pixel in the high nibble, with the
+# dim pixels already dithered. Cells at odd x start in the low nibble.
+# The dither pattern assumes the cells are drawn at an even y.
+#
+# Standalone:   python3 tools/glyphgen.py tools/eggogpgm.c lib/ilc2128l/eggog_atlas.h
+#
+import re
+import sys
+
+STRIDE = 357            # Tilemap width: 17 glyphs
+GLYPH_W = 21
+GLYPH_H = 28
+DOT_Y = 21              # Dot of the half-digit, rows within the cell
+DOT_H = 6
+NGLYPHS = 17
+ROW_BYTES = (1 + GLYPH_W + 1) // 2
+
+
+def read_tilemap(path):
+    text = open(path, encoding='utf-8').read()
+    m = re.search(r'eggog_traced_pgm\[\][^{]*\{(.*?)\};', text, re.S)
+    if not m:
+        raise SystemExit('%s: no eggog_traced_pgm' % path)
+    return [int(x) for x in re.findall(r'\d+', m.group(1))]
+
+
+def cell(tiles, odd, layers):
+    """Pack a cell drawn at x parity odd from (src_x, src_y, dst_row, rows) layers."""
+    pix = [[0] * GLYPH_W for _ in range(GLYPH_H)]
+    for src_x, src_y, dst_row, rows in layers:
+        for y in range(rows):
+            for x in range(GLYPH_W):
+                c = tiles[(y + src_y) * STRIDE + x + src_x] // 16
+                # Half-lit pixels on a checkerboard, as copy_glyph() did
+                if c == 1 and (odd + x ^ dst_row + y) & 1:
+                    c = 0
+                pix[dst_row + y][x] = c
+    out = []
+    for row in pix:
+        b = [0] * ROW_BYTES
+        for x, c in enumerate(row):
+            k = odd + x
+            b[k // 2] |= c << 4 if k % 2 == 0 else c
+        out += b
+    return out
+
+
+def generate(src, dst):
+    tiles = read_tilemap(src)
+    cells = []
+    for g in range(NGLYPHS):
+        for dot in range(2):
+            for odd in range(2):
+                cells.append(('digit %d%s, %s x' % (g, '.' if dot else '', 'odd' if odd else 'even'),
+                    cell(tiles, odd, [(GLYPH_W * g, 32 if dot else 0, 0, GLYPH_H)])))
+    for g in range(NGLYPHS):
+        for dot in range(2):
+            layers = [(GLYPH_W * g, 64, 0, GLYPH_H)]
+            if dot:
+                layers.append((GLYPH_W * 16, 64 + DOT_Y, DOT_Y, DOT_H))
+            cells.append(('half-digit %d%s' % (g, '.' if dot else ''), cell(tiles, 1, layers)))
+    for minus in range(2):
+        cells.append(('sign %s' % ('-' if minus else 'blank'),
+            cell(tiles, 0, [(GLYPH_W * 16, 32 if minus else 0, 0, GLYPH_H)])))
+
+    out = [
+        '/*',
+        ' * ILC2-12/8L glyph cells in the SH1122 RAM format.',
+        ' * Generated by tools/glyphgen.py from eggogpgm.c, do not edit.',
+        ' */',
+        '#define EGGOG_CELL_W       %d' % GLYPH_W,
+        '#define EGGOG_CELL_H       %d' % GLYPH_H,
+        '#define EGGOG_ROW_BYTES    %d' % ROW_BYTES,
+        '#define EGGOG_CELL_BYTES   (EGGOG_CELL_H * EGGOG_ROW_BYTES)',
+        '',
+        '// Glyph 0...%d with or without dot, at even or odd x' % (NGLYPHS - 1),
+        '#define EGGOG_DIGIT(g, dot, odd) &eggog_atlas[(((g) * 2 + (dot)) * 2 + (odd)) * EGGOG_CELL_BYTES]',
+        '// Position 9: top half of glyph g with the fat minus, odd x',
+        '#define EGGOG_HALF(g, dot) &eggog_atlas[(%d + (g) * 2 + (dot)) * EGGOG_CELL_BYTES]' % (NGLYPHS * 4),
+        '// Position 0: blank or minus, even x',
+        '#define EGGOG_SIGN(minus) &eggog_atlas[(%d + (minus)) * EGGOG_CELL_BYTES]' % (NGLYPHS * 6),
+        '',
+        'static const uint8_t eggog_atlas[] = {',
+    ]
+    for name, data in cells:
+        out.append('    // %s' % name)
+        for i in range(0, len(data), ROW_BYTES):
+            out.append('    ' + ' '.join('0x%02x,' % b for b in data[i:i + ROW_BYTES]))
+    out.append('};')
+
+    with open(dst, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        raise SystemExit('usage: glyphgen.py <eggogpgm.c> <eggog_atlas.h>')
+    generate(sys.argv[1], sys.argv[2])
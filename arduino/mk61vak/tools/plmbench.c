@@ -0,0 +1,230 @@
+/*
+ * Microbenchmark of the calculator engine on the host.
+ *
+ * Runs a calculator idle, then running a short endless program,
+ * and reports emulated cycles per second. With -DPLM_JIT it
+ * measures the interpreter and the native code tier side by side.
+ * Then the poll callback is timed at each cadence; build with
+ * -DCALC_NO_POLL to compare with the hook compiled out.
+ * The same program then runs in the opcode-level HLE, see hle.h,
+ * its result is stored back into the calculator and loaded again,
+ * and the functions the HLE leaves to the chips are checked.
+ */
+// Build from the project directory and run:
+//  cc -O2 -DPLM_JIT -Isrc -Isrc/mk61vak tools/plmbench.c src/mk61vak/*.c -lm -o plmbench
+//  ./plmbench [steps]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "calc.h"
+#include "hle.h"
+
+// Linked in by calc.c for the global calculator, unused here
+int calc_keypad (void) { return 0; }
+int calc_rgd (void) { return MODE_RADIANS; }
+void calc_display (int i, int digit, int dot) {}
+void calc_poll (void) {}
+void calc_running (int on) {}
+
+// 00: 1  01: +  02: БП 00
+static unsigned char loop_code[CODE_NBYTES] = { 0x01, 0x10, 0x51, 0x00 };
+
+// Press С/П once, long enough to register
+static int press_go (calc_ctx_t *c)
+{
+    int *words = c->user;
+
+    if (*words <= 0)
+        return 0;
+    --*words;
+    return KEY_STOPGO;
+}
+
+static double now (void)
+{
+    struct timespec ts;
+
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+//
+// Run a fresh calculator for the given number of steps,
+// polling at the given cadence.
+// Return emulated cycles per second.
+//
+static double run (int busy, int cadence, unsigned steps, unsigned *running)
+{
+    calc_ctx_t c;
+    int hold = 128;
+    unsigned i;
+    double t0;
+
+    calc_ctx_init (&c);
+    calc_ctx_set_poll (&c, cadence);
+    calc_ctx_step (&c);
+    if (busy) {
+        calc_ctx_write_code (&c, loop_code);
+        c.keypad = press_go;
+        c.user = &hold;
+    }
+
+    *running = 0;
+    t0 = now();
+    for (i=0; i<steps; i++)
+        *running += calc_ctx_step (&c);
+    return (double) steps * 560 * REG_NWORDS / (now() - t0);
+}
+
+static void report (const char *engine, unsigned steps)
+{
+    unsigned running;
+    double idle = run (0, CALC_POLL_WORD, steps, &running);
+    double busy = run (1, CALC_POLL_WORD, steps, &running);
+
+    printf ("%-12s idle %8.2f Mcycles/s   running %8.2f Mcycles/s (%u/%u steps running)\n",
+        engine, idle * 1e-6, busy * 1e-6, running, steps);
+}
+
+//
+// Speed with the poll callback called every word, every step, or never.
+//
+static void report_poll (unsigned steps)
+{
+#ifdef CALC_NO_POLL
+    unsigned running;
+    double idle = run (0, CALC_POLL_WORD, steps, &running);
+    double busy = run (1, CALC_POLL_WORD, steps, &running);
+
+    printf ("%-12s idle %8.2f Mcycles/s   running %8.2f Mcycles/s\n",
+        "no poll", idle * 1e-6, busy * 1e-6);
+#else
+    static const char *name[] = { "poll never", "poll step", "poll word" };
+    unsigned running;
+    int cadence;
+
+    for (cadence=CALC_POLL_WORD; cadence>=CALC_POLL_NEVER; cadence--) {
+        double idle = run (0, cadence, steps, &running);
+        double busy = run (1, cadence, steps, &running);
+
+        printf ("%-12s idle %8.2f Mcycles/s   running %8.2f Mcycles/s\n",
+            name[cadence], idle * 1e-6, busy * 1e-6);
+    }
+#endif
+}
+
+//
+// Instructions per second of the chips and of the HLE
+// on the endless program.
+//
+static void report_hle (unsigned steps)
+{
+    calc_ctx_t c;
+    calc_hle_t h;
+    int hold = 128;
+    unsigned long insns;
+    unsigned i;
+    double t0, x, chips, hle;
+
+    calc_ctx_init (&c);
+    calc_ctx_step (&c);
+    calc_ctx_write_code (&c, loop_code);
+    c.keypad = press_go;
+    c.user = &hold;
+    t0 = now();
+    for (i=0; i<steps; i++)
+        calc_ctx_step (&c);
+    chips = now() - t0;
+
+    // Every pass of three instructions adds 1; X + Y
+    // counts the passes wherever the program is.
+    calc_hle_load (&h, &c);
+    x = h.stack[1].mant * pow (10, h.stack[1].exp - 7) +
+        h.stack[2].mant * pow (10, h.stack[2].exp - 7);
+    chips = 3 * x / chips;
+
+    h.pc = 0;
+    t0 = now();
+    calc_hle_run (&h, 10000000, &insns);
+    hle = insns / (now() - t0);
+
+    printf ("%-12s %8.2f Minsns/s, chips %.4f Minsns/s, %.0f times faster\n",
+        "hle", hle * 1e-6, chips * 1e-6, hle / chips);
+
+    // Hand the result to the calculator and take it back
+    {
+        calc_hle_t h2;
+        unsigned char s1[5][6], s2[5][6], r1[DATA_NREGS][6], r2[DATA_NREGS][6];
+
+        calc_hle_store (&h, &c);
+        calc_hle_load (&h2, &c);
+        calc_hle_get_stack (&h, s1);
+        calc_hle_get_stack (&h2, s2);
+        calc_hle_get_regs (&h, r1);
+        calc_hle_get_regs (&h2, r2);
+        printf ("%-12s %s\n", "hle store",
+            (h.pc == h2.pc && memcmp (s1, s2, sizeof s1) == 0 &&
+             memcmp (r1, r2, sizeof r1) == 0) ? "ok" : "MISMATCH");
+    }
+}
+
+//
+// Each function of X in the differential mode: the instructions
+// before it must agree, and the HLE must stop at it unsupported.
+//
+static void report_hle_functions (void)
+{
+    static const unsigned char ops[] = {
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x24,
+    };
+    calc_ctx_t c;
+    calc_hle_diff_t r;
+    unsigned i, failed = 0;
+    int status;
+
+    for (i=0; i<sizeof ops; i++) {
+        // 2 В↑ 0 , 5 F op С/П: x^y takes Y too
+        unsigned char code[CODE_NBYTES] = {
+            0x02, 0x0e, 0x00, 0x0a, 0x05, ops[i], 0x50,
+        };
+
+        calc_ctx_init_fast (&c);
+        calc_ctx_set_rgd (&c, MODE_RADIANS);
+        calc_ctx_write_code (&c, code);
+        status = calc_hle_diff (&c, 20, &r);
+        if (status != CALC_HLE_UNSUPPORTED || r.pc != 5 || r.opcode != ops[i]) {
+            printf ("hle function %02X: status %d at %u after %lu instructions\n",
+                ops[i], status, r.pc, r.insns);
+            failed++;
+        }
+    }
+    printf ("%-12s %u of %u left to the chips\n", "hle funcs",
+        (unsigned) sizeof ops - failed, (unsigned) sizeof ops);
+}
+
+int main (int argc, char **argv)
+{
+    unsigned steps = argc > 1 ? atoi (argv[1]) : 2000;
+
+#if defined(PLM_COMPILED)
+    report ("compiled", steps);
+#elif defined(PLM_JIT)
+    unsigned words;
+    size_t bytes;
+
+    plm_jit_enable (0);
+    report ("interpreter", steps);
+    plm_jit_enable (1);
+    report ("jit", steps);
+    plm_jit_stats (&words, &bytes);
+    printf ("jit: %u instructions compiled, %zu bytes of code\n", words, bytes);
+#else
+    report ("interpreter", steps);
+#endif
+    report_poll (steps);
+    report_hle (steps);
+    report_hle_functions ();
+    return 0;
+}
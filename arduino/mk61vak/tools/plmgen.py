@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+#
+# Static recompiler for К145ИК130x microprograms.
+#
+# Reads ik1302.h, ik1303.h and ik1306.h and writes plm_compiled.c:
+# one straight-line C function per distinct instruction word of each
+# chip, running all 42 cycles of that word with every micro-instruction,
+# register index and keypad/display decision resolved ahead of time.
+# calc.c uses these instead of plm_step() when built with -DPLM_COMPILED.
+#
+# Standalone:   python3 tools/plmgen.py src/mk61vak src/mk61vak/plm_compiled.c
+# PlatformIO:   extra_scripts = pre:tools/plmgen.py
+#
+import os
+import re
+import sys
+
+REG_NWORDS = 42
+
+UCMD_ALPHA_R      = 0x0000001
+UCMD_ALPHA_M      = 0x0000002
+UCMD_ALPHA_ST     = 0x0000004
+UCMD_ALPHA_NR     = 0x0000008
+UCMD_ALPHA_C10    = 0x0000010
+UCMD_ALPHA_S      = 0x0000020
+UCMD_ALPHA_4      = 0x0000040
+UCMD_BETA_S       = 0x0000080
+UCMD_BETA_NS      = 0x0000100
+UCMD_BETA_Q       = 0x0000200
+UCMD_BETA_6       = 0x0000400
+UCMD_BETA_1       = 0x0000800
+UCMD_GAMMA_CARRY  = 0x0001000
+UCMD_GAMMA_NCARRY = 0x0002000
+UCMD_GAMMA_NKEY   = 0x0004000
+UCMD_R_MASK       = 0x0038000
+UCMD_R1_SUM       = 0x0040000
+UCMD_R2_SUM       = 0x0080000
+UCMD_M_S          = 0x0100000
+UCMD_CARRY_SUM    = 0x0200000
+UCMD_S_MASK       = 0x0c00000
+UCMD_Q_SUM        = 0x1000000
+UCMD_KEYPAD       = 0x2000000
+UCMD_ST_SUM       = 0x4000000
+UCMD_ST_ROT       = 0x8000000
+
+# Word within the 9-byte program for each cycle, as in plm_step()
+REMAP = [
+    0,1,2,  3,4,5,  3,4,5,  3,4,5,  3,4,5,  3,4,5,  3,4,5,
+    3,4,5,  6,7,8,  0,1,2,  3,4,5,  6,7,8,  0,1,2,  3,4,5,
+]
+
+CHIPS = ['ik1302', 'ik1303', 'ik1306']
+
+
+def read_rom(path, chip):
+    """Return (ucmd_rom, cmd_rom, prog_rom) lists parsed from a ROM header."""
+    text = open(path, encoding='utf-8').read()
+    roms = []
+    for name in ('ucmd_rom', 'cmd_rom', 'prog_rom'):
+        m = re.search(r'%s_%s\[[^]]*\][^{]*\{(.*?)\};' % (chip, name), text, re.S)
+        if not m:
+            raise SystemExit('%s: no %s_%s' % (path, chip, name))
+        body = re.sub(r'//[^\n]*', '', m.group(1))
+        roms.append([int(x, 0) for x in re.findall(r'0x[0-9A-Fa-f]+|\d+', body)])
+    return roms
+
+
+def get(reg, i):
+    """Read word i of a register, see nib_get()."""
+    return 'nib_get (t->%s, %d)' % (reg, i)
+
+
+def put(reg, i, value):
+    """Write word i of a register, see nib_set()."""
+    return 'nib_set (t->%s, %d, %s);' % (reg, i, value)
+
+
+def micro(op, c, scan, wr):
+    """C statements for micro-instruction op at cycle c."""
+    d = c // 3
+    p1, p2, p3 = (c + 1) % REG_NWORDS, (c + 2) % REG_NWORDS, (c + 3) % REG_NWORDS
+    m1, m2 = (c - 1) % REG_NWORDS, (c - 2) % REG_NWORDS
+    out = []
+
+    if op & UCMD_KEYPAD:
+        out.append('if (%d != t->keyb_x - 1 && t->keyb_y > 0) t->Q = t->keyb_y;' % d)
+
+    alpha = []
+    if op & UCMD_ALPHA_R:   alpha.append(get('R', c))
+    if op & UCMD_ALPHA_M:   alpha.append(get('M', c))
+    if op & UCMD_ALPHA_ST:  alpha.append(get('ST', c))
+    if op & UCMD_ALPHA_NR:  alpha.append('(%s ^ 0xf)' % get('R', c))
+    if op & UCMD_ALPHA_C10: alpha.append('(t->carry ? 0 : 0xa)')
+    if op & UCMD_ALPHA_S:   alpha.append('t->S')
+    if op & UCMD_ALPHA_4:   alpha.append('4')
+
+    beta = []
+    if op & UCMD_BETA_S:    beta.append('t->S')
+    if op & UCMD_BETA_NS:   beta.append('(t->S ^ 0xf)')
+    if op & UCMD_BETA_Q:    beta.append('t->Q')
+    k = (6 if op & UCMD_BETA_6 else 0) | (1 if op & UCMD_BETA_1 else 0)
+    if k:                   beta.append(str(k))
+
+    out.append('a = %s;' % (' | '.join(alpha) or '0'))
+    out.append('b = %s;' % (' | '.join(beta) or '0'))
+
+    if scan:
+        out.append('t->enable_display = 1;')
+        out.append('if (%d == t->keyb_x - 1 && t->keyb_y > 0) '
+                   '{ t->Q = t->keyb_y; t->keypad_event = 1; }' % d)
+        if d < 12:
+            out.append('if (t->carry) t->dot = %d;' % d)
+        out.append('t->show_dot[%d] = t->carry;' % d)
+    else:
+        out.append('if (t->keyb_y == 0) t->keypad_event = 0;')
+
+    gamma = []
+    if op & UCMD_GAMMA_CARRY:  gamma.append('t->carry')
+    if op & UCMD_GAMMA_NCARRY: gamma.append('(t->carry ^ 1)')
+    if op & UCMD_GAMMA_NKEY:   gamma.append('(t->keypad_event ^ 1)')
+    if len(gamma) > 1:
+        out.append('s = a + b + (%s);' % ' | '.join(gamma))
+    else:
+        out.append('s = a + b + %s;' % (gamma[0] if gamma else '0'))
+    if op & UCMD_CARRY_SUM:
+        out.append('t->carry = (s >> 4) & 1;')
+    out.append('s &= 0xf;')
+
+    if wr:
+        r = {
+            1: get('R', p3),
+            2: 's',
+            3: 't->S',
+            4: '%s | t->S | s' % get('R', c),
+            5: 't->S | s',
+            6: '%s | t->S' % get('R', c),
+            7: '%s | s' % get('R', c),
+        }.get((op & UCMD_R_MASK) >> 15)
+        if r:
+            out.append(put('R', c, r))
+        if op & UCMD_R1_SUM:
+            out.append(put('R', m1, 's'))
+        if op & UCMD_R2_SUM:
+            out.append(put('R', m2, 's'))
+
+    if op & UCMD_M_S:
+        out.append(put('M', c, 't->S'))
+
+    s_op = {
+        1: 't->S = t->Q;',
+        2: 't->S = s;',
+        3: 't->S = t->Q | s;',
+    }.get((op & UCMD_S_MASK) >> 22)
+    if s_op:
+        out.append(s_op)
+
+    if op & UCMD_Q_SUM:
+        out.append('t->Q = s;')
+
+    if op & UCMD_ST_SUM:
+        out.append(put('ST', p2, get('ST', p1)))
+        out.append(put('ST', p1, get('ST', c)))
+        out.append(put('ST', c, 's'))
+    if op & UCMD_ST_ROT:
+        out.append('x = %s;' % get('ST', c))
+        out.append(put('ST', c, get('ST', p1)))
+        out.append(put('ST', p1, get('ST', p2)))
+        out.append(put('ST', p2, 'x'))
+    return out
+
+
+def word(chip, command, ucmd_rom, prog_rom):
+    """C function for one instruction word."""
+    scan = (command & 0xfc0000) == 0
+    modifier = (command >> 24) & 0xff
+    lines = ['static void %s_w%08X (plm_t *t, const uint8_t in[], uint8_t out[])'
+             % (chip, command), '{', '    unsigned a, b, s, x;', '']
+
+    for c in range(REG_NWORDS):
+        if c < 27:
+            prog_index = command & 0xff
+        elif c < 36:
+            prog_index = (command >> 8) & 0xff
+        else:
+            prog_index = (command >> 16) & 0xff
+            if prog_index > 0x1f:
+                if c == 36:
+                    lines.append('    ' + put('R', 37, prog_index & 0xf))
+                    lines.append('    ' + put('R', 40, prog_index >> 4))
+                prog_index = 0x5f
+        inst_addr = prog_rom[prog_index * 9 + REMAP[c]] & 0x3f
+        wr = modifier == 0 or c >= 36
+
+        if inst_addr >= 60:
+            inst_addr += inst_addr - 60
+            lines.append('    /* %d */' % c)
+            lines.append('    if (t->carry) {')
+            lines += ['        ' + s for s in micro(ucmd_rom[inst_addr], c, scan, wr)]
+            lines.append('    } else {')
+            lines += ['        ' + s for s in micro(ucmd_rom[inst_addr + 1], c, scan, wr)]
+            lines.append('    }')
+        else:
+            lines.append('    /* %d */' % c)
+            lines += ['    ' + s for s in micro(ucmd_rom[inst_addr], c, scan, wr)]
+        lines.append('    out[%d] = %s & 0xf;' % (c, get('M', c)))
+        lines.append('    ' + put('M', c, 'in[%d]' % c))
+
+    lines += ['    (void) x;', '}', '']
+    return lines
+
+
+def generate(src_dir, dst):
+    out = [
+        '/*',
+        ' * Compiled К145ИК130x microprograms.',
+        ' * Generated by tools/plmgen.py from ik130x.h, do not edit.',
+        ' */',
+        '#ifdef PLM_COMPILED',
+        '#include "calc.h"',
+        '',
+    ]
+    for chip in CHIPS:
+        ucmd_rom, cmd_rom, prog_rom = read_rom(os.path.join(src_dir, chip + '.h'), chip)
+        if chip == 'ik1306':
+            out.append('#ifndef MK_54')
+        for command in sorted(set(cmd_rom)):
+            out += word(chip, command, ucmd_rom, prog_rom)
+        out.append('const plm_word_t %s_words[CMD_NWORDS] = {' % chip)
+        for i in range(0, len(cmd_rom), 4):
+            out.append('    ' + ' '.join('%s_w%08X,' % (chip, w) for w in cmd_rom[i:i + 4]))
+        out.append('};')
+        if chip == 'ik1306':
+            out.append('#endif')
+        out.append('')
+    out.append('#endif')
+
+    with open(dst, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+def outdated(src_dir, dst):
+    if not os.path.exists(dst):
+        return True
+    deps = [os.path.join(src_dir, c + '.h') for c in CHIPS] + [os.path.abspath(__file__)]
+    return any(os.path.getmtime(p) > os.path.getmtime(dst) for p in deps)
+
+
+try:
+    Import('env')                       # noqa: F821 -- PlatformIO pre: script
+except NameError:
+    env = None
+
+if env is not None:
+    src = os.path.join(env.subst('$PROJECT_SRC_DIR'), 'mk61vak')
+    dst = os.path.join(src, 'plm_compiled.c')
+    if outdated(src, dst):
+        print('plmgen: writing', dst)
+        generate(src, dst)
+elif __name__ == '__main__':
+    if len(sys.argv) != 3:
+        raise SystemExit('usage: plmgen.py <dir with ik130x.h> <output.c>')
+    generate(sys.argv[1], sys.argv[2])
@@ -0,0 +1,58 @@
+/*
+ * Generator of the micro-address tables, see plm_rom_t.
+ *
+ * Resolves the micro-address of every instruction and cycle
+ * of each ROM set and writes them as C arrays, so they stay
+ * in flash instead of being built in RAM at power-on.
+ * Run again whenever the ROMs change.
+ */
+// Build from the project directory and run:
+//  cc -O2 -Isrc -Isrc/mk61vak tools/useqgen.c src/mk61vak/ik13.c -o useqgen
+//  ./useqgen src/mk61vak/useq.h
+#include <stdio.h>
+#include "compat.h"
+#include "calc.h"
+#include "ik1302.h"
+#include "ik1303.h"
+#include "ik1306.h"
+
+static void table (FILE *out, const char *name,
+    const uint32_t cmd_rom[], const uint8_t prog_rom[])
+{
+    uint8_t useq [REG_NWORDS];
+    unsigned pc, cycle;
+
+    fprintf (out, "static const uint8_t %s_useq_rom[CMD_NWORDS][REG_NWORDS] PROGMEM = {\n", name);
+    for (pc=0; pc<CMD_NWORDS; pc++) {
+        plm_useq_decode (useq, prog_rom, cmd_rom[pc]);
+        fprintf (out, "    {");
+        for (cycle=0; cycle<REG_NWORDS; cycle++)
+            fprintf (out, "%s0x%02x,", cycle % 14 ? " " : "\n        ",
+                useq[cycle]);
+        fprintf (out, "\n    },\n");
+    }
+    fprintf (out, "};\n");
+}
+
+int main (int argc, char **argv)
+{
+    FILE *out = stdout;
+
+    if (argc > 1 && ! (out = fopen (argv[1], "w"))) {
+        perror (argv[1]);
+        return 1;
+    }
+    fprintf (out, "/*\n");
+    fprintf (out, " * Micro-address of every instruction and cycle of the ROM sets.\n");
+    fprintf (out, " * Generated by tools/useqgen.c, do not edit.\n");
+    fprintf (out, " */\n");
+    table (out, "ik1302", ik1302_cmd_rom, ik1302_prog_rom);
+    fprintf (out, "\n");
+    table (out, "ik1303", ik1303_cmd_rom, ik1303_prog_rom);
+    fprintf (out, "\n#ifndef MK_54\n");
+    table (out, "ik1306", ik1306_cmd_rom, ik1306_prog_rom);
+    fprintf (out, "#endif\n");
+    if (out != stdout)
+        fclose (out);
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * Benchmark of the display stack on the host.
+ *
+ * Drives ILC2128L through the simulated SH1122 of sh1122_hal_host.cpp
+ * and reports refreshes per second, bytes sent per refresh and the time
+ * they would take on the SPI wire, for a static display, one digit
+ * changing, and every digit changing. Before that whole frames are drawn
+ * and sent at the real SPI clock, waiting for each transfer or overlapping
+ * it with drawing the next frame. The last frame is saved as a picture
+ * when a file name is given.
+ */
+// Build from the project directory and run:
+//  cc -O2 -c -Ilib/sh1122 lib/sh1122/sh1122.c lib/sh1122/fonts/*.c
+//  c++ -O2 -Ilib/sh1122 -Ilib/ilc2128l tools/vfdbench.cpp lib/ilc2128l/ilc2128l.cpp lib/sh1122/sh1122_hal_host.cpp *.o -lpthread -o vfdbench
+//  ./vfdbench [frames] [out.png|out.pgm]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ilc2128l.h"
+#include "sh1122.h"
+#include "sh1122_hal_host.h"
+
+static ILC2128L ilc(0, 0, 0);
+
+static double now()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+//
+// Refresh the given number of frames, changing that many digits
+// before each, and print the rates.
+//
+static void report(const char *name, int changing, unsigned frames)
+{
+    SH1122_HostStats s;
+    double t0 = 0, t;
+
+    // Frame 0 is shown before timing starts
+    for (unsigned f = 0; f <= frames; ++f) {
+        if (f == 1) {
+            SH1122_Host_ResetStats();
+            t0 = now();
+        }
+        for (int i = 0; i < 12; ++i) {
+            ilc.set_digit(i, i < changing ? (f + i) % 10 : i % 10, i == 2);
+        }
+        ilc.flip_buffers();
+        ilc.refresh();
+    }
+    t = now() - t0;
+    SH1122_Host_GetStats(&s);
+
+    printf("%-12s %9.0f refresh/s   %7.1f data + %5.1f command bytes   %8.1f us SPI per refresh\n",
+        name, frames / t, (double) s.DataBytes / frames, (double) s.CommandBytes / frames,
+        s.SpiSeconds / frames * 1e6);
+}
+
+//
+// Draw and send whole frames with transfers limited to the SPI clock,
+// and print the rate and the time spent waiting for the wire.
+//
+static void report_frames(const char *name, bool overlap, unsigned frames)
+{
+    double t0, t, stall = 0;
+
+    SH1122_Host_LimitBandwidth(20000000);
+    t0 = now();
+    for (unsigned f = 0; f < frames; ++f) {
+        Frame_Clear(0);
+        for (int i = 0; i < 8; ++i) {
+            Frame_printf(i * 32, i * 8, 0, Display_Color.Gray_15, LEFT, TOP, "%08u", f * 8 + i);
+        }
+
+        double ts = now();
+        Display_SendFrame();
+        if (!overlap) {
+            Display_Wait();
+        }
+        stall += now() - ts;
+    }
+    Display_Wait();
+    t = now() - t0;
+    SH1122_Host_LimitBandwidth(0);
+
+    printf("%-12s %9.0f frame/s     %7.1f us waiting per frame\n",
+        name, frames / t, stall / frames * 1e6);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned frames = argc > 1 ? atoi(argv[1]) : 10000;
+
+    // Before the digits, which expect a picture of their own
+    Display_Init();
+    report_frames("frame, wait", false, frames / 10);
+    report_frames("frame, async", true, frames / 10);
+
+    ilc.begin();
+    report("static", 0, frames);
+    report("one digit", 1, frames);
+    report("all digits", 12, frames);
+
+    if (argc > 2) {
+        const char *ext = strrchr(argv[2], '.');
+        int err = ext && strcmp(ext, ".pgm") == 0 ?
+            SH1122_Host_SavePGM(argv[2]) : SH1122_Host_SavePNG(argv[2]);
+        if (err) {
+            perror(argv[2]);
+            return 1;
+        }
+    }
+    return 0;
+}